@@ -26,6 +26,26 @@ constexpr numeric_vector<9> x0; // {x, y, z, v_x, v_y, v_z, a_x, a_y, a_z}
 
 kalman_filter_t<9, 3, 1> kf(F, B, H, Q, R, x0);
 
+// The model is three identical decoupled axes, F = F1 (x) I3, so it can run as one 3-state filter.
+// B is zero and is not factored: it is 9 x 1, which cannot be B1 (x) I3, so B1 is simply a zero 3 x 1 input.
+numeric_matrix<3, 3> F1, Q1;
+const numeric_matrix<3, 1> B1;
+numeric_matrix<1, 3> H1;
+numeric_matrix<1, 1> R1;
+const bool separable = kron_identity_factor<3>(F, F1) && kron_identity_factor<3>(H, H1) &&
+                       kron_identity_factor<3>(Q, Q1) && kron_identity_factor<3>(R, R1);
+
 int main() {
+    if (!separable) return 1;
+    separable_kalman_filter_t<3, 3, 1, 1> skf(F1, B1, H1, Q1, R1, x0);
+
+    // Both filters track the same accelerating target and must agree
+    for (int k = 0; k < 50; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<3> z({0.5 * t * t, 10 - 2 * t, 3 * t});
+        kf.predict().update(z);
+        skf.predict().update(z);
+        if (!skf.state_vector().float_equals(kf.state_vector, 1e-6)) return 1;
+    }
     return 0;
 }
@@ -0,0 +1,369 @@
+/**
+ * @file bounded_numeric_matrix.h
+ * @brief Numeric vector and matrix with runtime dimensions inside static storage
+ */
+
+#ifndef VT_LINALG_BOUNDED_NUMERIC_MATRIX_H
+#define VT_LINALG_BOUNDED_NUMERIC_MATRIX_H
+
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+#include <assert.h>
+
+namespace vt {
+    namespace impl {
+        /**
+         * Numeric vector whose size is chosen at runtime, up to MaxSize, without heap usage.
+         * Operations only touch the first size() entries.
+         *
+         * @tparam T data type
+         * @tparam MaxSize capacity
+         */
+        template<typename T, size_t MaxSize>
+        class numeric_vector_bounded_t {
+        public:
+            static_assert(MaxSize > 0, "Capacity must be greater than 0.");
+
+        private:
+            T arr_[MaxSize] = {};
+            size_t size_    = 0;
+
+        public:
+            constexpr numeric_vector_bounded_t() = default;
+
+            /**
+             * Zero vector of the given size
+             *
+             * @param size Size, at most MaxSize
+             */
+            explicit constexpr numeric_vector_bounded_t(size_t size) : size_(size) { assert(size <= MaxSize); }
+
+            /**
+             * Gathers entries of a static vector
+             *
+             * @tparam Size
+             * @param v Source vector
+             * @param indices Source indices
+             * @param count Number of indices
+             */
+            template<size_t Size>
+            numeric_vector_bounded_t(const numeric_vector_static_t<T, Size> &v, const size_t *indices, size_t count) : size_(count) {
+                assert(count <= MaxSize);
+                for (size_t i = 0; i < count; ++i) arr_[i] = v[indices[i]];
+            }
+
+            T &operator[](size_t index) { return arr_[index]; }
+
+            constexpr const T &operator[](size_t index) const { return arr_[index]; }
+
+            [[nodiscard]] constexpr size_t size() const { return size_; }
+
+            [[nodiscard]] static constexpr size_t max_size() { return MaxSize; }
+
+            void resize(size_t size) {
+                assert(size <= MaxSize);
+                for (size_t i = size_; i < size; ++i) arr_[i] = 0;
+                size_ = size;
+            }
+
+            numeric_vector_bounded_t &operator+=(const numeric_vector_bounded_t &other) {
+                for (size_t i = 0; i < size_; ++i) arr_[i] += other.arr_[i];
+                return *this;
+            }
+
+            numeric_vector_bounded_t &operator-=(const numeric_vector_bounded_t &other) {
+                for (size_t i = 0; i < size_; ++i) arr_[i] -= other.arr_[i];
+                return *this;
+            }
+
+            numeric_vector_bounded_t operator+(const numeric_vector_bounded_t &other) const {
+                numeric_vector_bounded_t tmp(*this);
+                return tmp += other;
+            }
+
+            numeric_vector_bounded_t operator-(const numeric_vector_bounded_t &other) const {
+                numeric_vector_bounded_t tmp(*this);
+                return tmp -= other;
+            }
+
+            T dot(const numeric_vector_bounded_t &other) const {
+                T sum_ = 0;
+                for (size_t i = 0; i < size_; ++i) sum_ += arr_[i] * other.arr_[i];
+                return sum_;
+            }
+        };
+
+        /**
+         * Numeric matrix whose dimensions are chosen at runtime, up to MaxRow x MaxCol,
+         * without heap usage. Operations only touch the leading r() x c() block, so their
+         * cost scales with the runtime dimensions rather than the capacity.
+         *
+         * @tparam T data type
+         * @tparam MaxRow row capacity
+         * @tparam MaxCol column capacity
+         */
+        template<typename T, size_t MaxRow, size_t MaxCol>
+        class numeric_matrix_bounded_t {
+        public:
+            static_assert(MaxRow > 0, "Row capacity must be greater than 0.");
+            static_assert(MaxCol > 0, "Column capacity must be greater than 0.");
+
+        private:
+            template<typename U, size_t R, size_t C>
+            friend class numeric_matrix_bounded_t;
+
+            T arr_[MaxRow][MaxCol] = {};
+            size_t r_              = 0;
+            size_t c_              = 0;
+
+        public:
+            constexpr numeric_matrix_bounded_t() = default;
+
+            /**
+             * Zero matrix of the given dimensions
+             *
+             * @param rows Row dimension, at most MaxRow
+             * @param cols Column dimension, at most MaxCol
+             */
+            constexpr numeric_matrix_bounded_t(size_t rows, size_t cols) : r_(rows), c_(cols) {
+                assert(rows <= MaxRow && cols <= MaxCol);
+            }
+
+            /**
+             * Copies a static matrix that fits the capacity
+             *
+             * @tparam Row
+             * @tparam Col
+             * @param M Source matrix
+             */
+            template<size_t Row, size_t Col>
+            explicit numeric_matrix_bounded_t(const numeric_matrix_static_t<T, Row, Col> &M) : r_(Row), c_(Col) {
+                static_assert(Row <= MaxRow && Col <= MaxCol, "Matrix exceeds bounded capacity.");
+                for (size_t i = 0; i < Row; ++i)
+                    for (size_t j = 0; j < Col; ++j) arr_[i][j] = M[i][j];
+            }
+
+            /**
+             * Gathers selected rows and all columns of a static matrix
+             *
+             * @tparam Row
+             * @tparam Col
+             * @param M Source matrix
+             * @param rows Source row indices
+             * @param count Number of row indices
+             */
+            template<size_t Row, size_t Col>
+            numeric_matrix_bounded_t(const numeric_matrix_static_t<T, Row, Col> &M, const size_t *rows, size_t count) : r_(count), c_(Col) {
+                static_assert(Col <= MaxCol, "Matrix exceeds bounded capacity.");
+                assert(count <= MaxRow);
+                for (size_t i = 0; i < count; ++i)
+                    for (size_t j = 0; j < Col; ++j) arr_[i][j] = M[rows[i]][j];
+            }
+
+            /**
+             * Gathers the principal submatrix of selected rows and columns of a static matrix
+             *
+             * @tparam Order
+             * @param M Source square matrix
+             * @param indices Source row and column indices
+             * @param count Number of indices
+             * @return Principal submatrix
+             */
+            template<size_t Order>
+            static numeric_matrix_bounded_t principal(const numeric_matrix_static_t<T, Order, Order> &M, const size_t *indices, size_t count) {
+                numeric_matrix_bounded_t result(count, count);
+                for (size_t i = 0; i < count; ++i)
+                    for (size_t j = 0; j < count; ++j) result.arr_[i][j] = M[indices[i]][indices[j]];
+                return result;
+            }
+
+            T *operator[](size_t index) { return arr_[index]; }
+
+            constexpr const T *operator[](size_t index) const { return arr_[index]; }
+
+            T &at(size_t r_index, size_t c_index) { return arr_[r_index][c_index]; }
+
+            constexpr const T &at(size_t r_index, size_t c_index) const { return arr_[r_index][c_index]; }
+
+            T &operator()(size_t r_index, size_t c_index) { return at(r_index, c_index); }
+
+            constexpr const T &operator()(size_t r_index, size_t c_index) const { return at(r_index, c_index); }
+
+            [[nodiscard]] constexpr size_t r() const { return r_; }
+
+            [[nodiscard]] constexpr size_t c() const { return c_; }
+
+            /**
+             * Changes runtime dimensions, entries entering the active block are zeroed
+             *
+             * @param rows Row dimension, at most MaxRow
+             * @param cols Column dimension, at most MaxCol
+             */
+            void resize(size_t rows, size_t cols) {
+                assert(rows <= MaxRow && cols <= MaxCol);
+                for (size_t i = 0; i < rows; ++i)
+                    for (size_t j = (i < r_ ? c_ : 0); j < cols; ++j) arr_[i][j] = 0;
+                r_ = rows;
+                c_ = cols;
+            }
+
+            numeric_matrix_bounded_t &operator+=(const numeric_matrix_bounded_t &other) {
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < c_; ++j) arr_[i][j] += other.arr_[i][j];
+                return *this;
+            }
+
+            numeric_matrix_bounded_t &operator-=(const numeric_matrix_bounded_t &other) {
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < c_; ++j) arr_[i][j] -= other.arr_[i][j];
+                return *this;
+            }
+
+            numeric_matrix_bounded_t operator+(const numeric_matrix_bounded_t &other) const {
+                numeric_matrix_bounded_t tmp(*this);
+                return tmp += other;
+            }
+
+            numeric_matrix_bounded_t operator-(const numeric_matrix_bounded_t &other) const {
+                numeric_matrix_bounded_t tmp(*this);
+                return tmp -= other;
+            }
+
+            template<size_t OMaxCol>
+            numeric_matrix_bounded_t<T, MaxRow, OMaxCol> operator*(const numeric_matrix_bounded_t<T, MaxCol, OMaxCol> &other) const {
+                numeric_matrix_bounded_t<T, MaxRow, OMaxCol> result(r_, other.c_);
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t k = 0; k < c_; ++k) {
+                        const T a_ik = arr_[i][k];
+                        for (size_t j = 0; j < other.c_; ++j) result.arr_[i][j] += a_ik * other.arr_[k][j];
+                    }
+                return result;
+            }
+
+            numeric_vector_bounded_t<T, MaxRow> operator*(const numeric_vector_bounded_t<T, MaxCol> &v) const {
+                numeric_vector_bounded_t<T, MaxRow> result(r_);
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < c_; ++j) result[i] += arr_[i][j] * v[j];
+                return result;
+            }
+
+            /**
+             * Multiplies by the transpose of other, A * B^T
+             *
+             * @tparam OMaxRow
+             * @param other Matrix B
+             * @return A * B^T
+             */
+            template<size_t OMaxRow>
+            numeric_matrix_bounded_t<T, MaxRow, OMaxRow> matmul_T(const numeric_matrix_bounded_t<T, OMaxRow, MaxCol> &other) const {
+                numeric_matrix_bounded_t<T, MaxRow, OMaxRow> result(r_, other.r_);
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < other.r_; ++j) {
+                        T sum_ = 0;
+                        for (size_t k = 0; k < c_; ++k) sum_ += arr_[i][k] * other.arr_[j][k];
+                        result.arr_[i][j] = sum_;
+                    }
+                return result;
+            }
+
+            numeric_matrix_bounded_t<T, MaxCol, MaxRow> transpose() const {
+                numeric_matrix_bounded_t<T, MaxCol, MaxRow> result(c_, r_);
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < c_; ++j) result.arr_[j][i] = arr_[i][j];
+                return result;
+            }
+
+            /**
+             * Finds lower-triangular L such that L * L^T equals this symmetric positive semi-definite matrix.\n
+             * Pivots that vanish relative to the diagonal entry leave a zero column.
+             *
+             * @return Lower-triangular Cholesky factor
+             */
+            numeric_matrix_bounded_t cholesky() const {
+                numeric_matrix_bounded_t L(r_, r_);
+                for (size_t j = 0; j < r_; ++j) {
+                    T d = arr_[j][j];
+                    for (size_t k = 0; k < j; ++k) d -= L.arr_[j][k] * L.arr_[j][k];
+                    if (d <= epsilon<T>() * abs(arr_[j][j])) continue;
+                    L.arr_[j][j] = sqrt(d);
+                    for (size_t i = j + 1; i < r_; ++i) {
+                        T sum_ = arr_[i][j];
+                        for (size_t k = 0; k < j; ++k) sum_ -= L.arr_[i][k] * L.arr_[j][k];
+                        L.arr_[i][j] = sum_ / L.arr_[j][j];
+                    }
+                }
+                return L;
+            }
+
+            /**
+             * Solves (L * L^T) * x = b in place, where L is this lower-triangular Cholesky factor.\n
+             * Zero pivots yield zero entries.
+             *
+             * @param b Right-hand side vector, overwritten by the solution
+             */
+            void cholesky_solve_in_place(T *b) const {
+                for (size_t i = 0; i < r_; ++i) {
+                    if (arr_[i][i] == 0) {
+                        b[i] = 0;
+                        continue;
+                    }
+                    for (size_t k = 0; k < i; ++k) b[i] -= arr_[i][k] * b[k];
+                    b[i] /= arr_[i][i];
+                }
+                for (size_t i = r_; i-- > 0;) {
+                    if (arr_[i][i] == 0) continue;
+                    for (size_t k = i + 1; k < r_; ++k) b[i] -= arr_[k][i] * b[k];
+                    b[i] /= arr_[i][i];
+                }
+            }
+
+            numeric_vector_bounded_t<T, MaxRow> cholesky_solve(const numeric_vector_bounded_t<T, MaxRow> &b) const {
+                numeric_vector_bounded_t<T, MaxRow> x(b);
+                cholesky_solve_in_place(&x[0]);
+                return x;
+            }
+
+            /**
+             * Solves (L * L^T) * X = B, where L is this lower-triangular Cholesky factor.
+             *
+             * @tparam OMaxCol
+             * @param B Right-hand side matrix
+             * @return Solution matrix
+             */
+            template<size_t OMaxCol>
+            numeric_matrix_bounded_t<T, MaxRow, OMaxCol> cholesky_solve(const numeric_matrix_bounded_t<T, MaxRow, OMaxCol> &B) const {
+                numeric_matrix_bounded_t<T, MaxRow, OMaxCol> X(B.r_, B.c_);
+                T col_[MaxRow];
+                for (size_t j = 0; j < B.c_; ++j) {
+                    for (size_t i = 0; i < r_; ++i) col_[i] = B.arr_[i][j];
+                    cholesky_solve_in_place(col_);
+                    for (size_t i = 0; i < r_; ++i) X.arr_[i][j] = col_[i];
+                }
+                return X;
+            }
+
+            bool float_equals(const numeric_matrix_bounded_t &other, real_t threshold = 1e-12) const {
+                if (r_ != other.r_ || c_ != other.c_) return false;
+                for (size_t i = 0; i < r_; ++i)
+                    for (size_t j = 0; j < c_; ++j)
+                        if (abs(arr_[i][j] - other.arr_[i][j]) > threshold) return false;
+                return true;
+            }
+        };
+    }  // namespace impl
+
+    template<typename T, size_t MaxSize>
+    using generic_vector_bounded = impl::numeric_vector_bounded_t<T, MaxSize>;
+
+    template<typename T, size_t MaxRow, size_t MaxCol>
+    using generic_matrix_bounded = impl::numeric_matrix_bounded_t<T, MaxRow, MaxCol>;
+
+    template<size_t MaxSize>
+    using numeric_vector_bounded = impl::numeric_vector_bounded_t<real_t, MaxSize>;
+
+    template<size_t MaxRow, size_t MaxCol>
+    using numeric_matrix_bounded = impl::numeric_matrix_bounded_t<real_t, MaxRow, MaxCol>;
+}  // namespace vt
+
+#endif  //VT_LINALG_BOUNDED_NUMERIC_MATRIX_H
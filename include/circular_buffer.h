@@ -36,6 +36,10 @@ namespace vt {
             for (size_t i = 0; i < Capacity; ++i) arr_[i] = vt::move(other.arr_[i]);
         }
 
+        circular_buffer_static_t &operator=(const circular_buffer_static_t &other) = default;
+
+        circular_buffer_static_t &operator=(circular_buffer_static_t &&other) noexcept = default;
+
         void push(const T &t) {
             if (full()) return;
             arr_[cyclic<Capacity>(start_index_ + size_)] = move(t);
@@ -48,6 +52,21 @@ namespace vt {
             static_cast<void>(++size_);
         }
 
+        /**
+         * Pushes to the back, dropping the front element when the buffer is full.
+         *
+         * @param t Element
+         */
+        void push_overwrite(const T &t) {
+            if (full()) pop();
+            push(t);
+        }
+
+        void push_overwrite(T &&t) {
+            if (full()) pop();
+            push(vt::move(t));
+        }
+
         void pop() {
             if (empty()) return;
             start_index_ = cyclic<Capacity>(start_index_ + 1);
@@ -56,11 +75,26 @@ namespace vt {
 
         T &front() { return arr_[start_index_]; }
 
-        constexpr T &front() const { return arr_[start_index_]; }
+        constexpr const T &front() const { return arr_[start_index_]; }
 
         T &back() { return arr_[cyclic<Capacity>(start_index_ + size_ - 1)]; }
 
-        constexpr T &back() const { return arr_[cyclic<Capacity>(start_index_ + size_ - 1)]; }
+        constexpr const T &back() const { return arr_[cyclic<Capacity>(start_index_ + size_ - 1)]; }
+
+        /**
+         * Accesses element by age, index 0 is the front (oldest) element.
+         *
+         * @param index Index from the front
+         * @return Element
+         */
+        T &operator[](size_t index) { return arr_[cyclic<Capacity>(start_index_ + index)]; }
+
+        constexpr const T &operator[](size_t index) const { return arr_[cyclic<Capacity>(start_index_ + index)]; }
+
+        void clear() {
+            start_index_ = 0;
+            size_        = 0;
+        }
 
         constexpr bool empty() const { return (size_ == 0); }
 
@@ -0,0 +1,349 @@
+/**
+ * @file dual_number.h
+ * @brief Forward-mode automatic differentiation with dual numbers
+ *
+ * A dual number a + b_1 e_1 + ... + b_D e_D with e_i e_j = 0 carries its value and D directional
+ * derivatives through every arithmetic operation. Seeding direction i on input x_i yields the full
+ * Jacobian of a vector function from one evaluation.
+ */
+
+#ifndef VT_LINALG_DUAL_NUMBER_H
+#define VT_LINALG_DUAL_NUMBER_H
+
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    // Keep real overloads visible next to the dual overloads declared in this namespace
+    using ::abs;
+    using ::acos;
+    using ::asin;
+    using ::atan;
+    using ::atan2;
+    using ::cos;
+    using ::exp;
+    using ::fabs;
+    using ::log;
+    using ::pow;
+    using ::sin;
+    using ::sqrt;
+    using ::tan;
+
+    /**
+     * Dual number with D derivative directions.
+     *
+     * @tparam T data type
+     * @tparam D number of derivative directions
+     */
+    template<typename T, size_t D>
+    class dual_t {
+    private:
+        T real_    = 0;
+        T dual_[D] = {};
+
+    public:
+        using value_type = T;
+
+        constexpr dual_t() = default;
+
+        constexpr dual_t(T real) : real_(real) {}
+
+        /**
+         * Creates a variable seeded in one direction (derivative 1 along that direction).
+         *
+         * @param real Value
+         * @param direction Seeded direction
+         */
+        constexpr dual_t(T real, size_t direction) : real_(real) { dual_[direction] = 1; }
+
+        constexpr dual_t(const dual_t &other) = default;
+
+        constexpr dual_t(dual_t &&other) noexcept = default;
+
+        dual_t &operator=(const dual_t &other) = default;
+
+        dual_t &operator=(dual_t &&other) noexcept = default;
+
+        dual_t &operator=(T real) {
+            real_ = real;
+            for (size_t i = 0; i < D; ++i) dual_[i] = 0;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr const T &real() const { return real_; }
+
+        [[nodiscard]] constexpr const T &dual(size_t direction) const { return dual_[direction]; }
+
+        T &dual(size_t direction) { return dual_[direction]; }
+
+        dual_t &operator+=(const dual_t &rhs) {
+            real_ += rhs.real_;
+            for (size_t i = 0; i < D; ++i) dual_[i] += rhs.dual_[i];
+            return *this;
+        }
+
+        dual_t &operator+=(T rhs) {
+            real_ += rhs;
+            return *this;
+        }
+
+        dual_t &operator-=(const dual_t &rhs) {
+            real_ -= rhs.real_;
+            for (size_t i = 0; i < D; ++i) dual_[i] -= rhs.dual_[i];
+            return *this;
+        }
+
+        dual_t &operator-=(T rhs) {
+            real_ -= rhs;
+            return *this;
+        }
+
+        dual_t &operator*=(const dual_t &rhs) {
+            for (size_t i = 0; i < D; ++i) dual_[i] = dual_[i] * rhs.real_ + real_ * rhs.dual_[i];
+            real_ *= rhs.real_;
+            return *this;
+        }
+
+        dual_t &operator*=(T rhs) {
+            real_ *= rhs;
+            for (size_t i = 0; i < D; ++i) dual_[i] *= rhs;
+            return *this;
+        }
+
+        dual_t &operator/=(const dual_t &rhs) {
+            const T inv_ = 1 / rhs.real_;
+            real_ *= inv_;
+            for (size_t i = 0; i < D; ++i) dual_[i] = (dual_[i] - real_ * rhs.dual_[i]) * inv_;
+            return *this;
+        }
+
+        dual_t &operator/=(T rhs) {
+            const T inv_ = 1 / rhs;
+            real_ *= inv_;
+            for (size_t i = 0; i < D; ++i) dual_[i] *= inv_;
+            return *this;
+        }
+
+        dual_t operator+(const dual_t &rhs) const {
+            dual_t tmp(*this);
+            tmp.operator+=(rhs);
+            return tmp;
+        }
+
+        dual_t operator+(T rhs) const {
+            dual_t tmp(*this);
+            tmp.operator+=(rhs);
+            return tmp;
+        }
+
+        dual_t operator-(const dual_t &rhs) const {
+            dual_t tmp(*this);
+            tmp.operator-=(rhs);
+            return tmp;
+        }
+
+        dual_t operator-(T rhs) const {
+            dual_t tmp(*this);
+            tmp.operator-=(rhs);
+            return tmp;
+        }
+
+        dual_t operator*(const dual_t &rhs) const {
+            dual_t tmp(*this);
+            tmp.operator*=(rhs);
+            return tmp;
+        }
+
+        dual_t operator*(T rhs) const {
+            dual_t tmp(*this);
+            tmp.operator*=(rhs);
+            return tmp;
+        }
+
+        dual_t operator/(const dual_t &rhs) const {
+            dual_t tmp(*this);
+            tmp.operator/=(rhs);
+            return tmp;
+        }
+
+        dual_t operator/(T rhs) const {
+            dual_t tmp(*this);
+            tmp.operator/=(rhs);
+            return tmp;
+        }
+
+        dual_t operator-() const {
+            dual_t tmp;
+            tmp.real_ = -real_;
+            for (size_t i = 0; i < D; ++i) tmp.dual_[i] = -dual_[i];
+            return tmp;
+        }
+
+        constexpr dual_t operator+() const { return *this; }
+
+        // Comparisons act on the value only, so branches in models follow the primal path
+
+        constexpr bool operator==(const dual_t &rhs) const { return real_ == rhs.real_; }
+
+        constexpr bool operator!=(const dual_t &rhs) const { return real_ != rhs.real_; }
+
+        constexpr bool operator<(const dual_t &rhs) const { return real_ < rhs.real_; }
+
+        constexpr bool operator>(const dual_t &rhs) const { return real_ > rhs.real_; }
+
+        constexpr bool operator<=(const dual_t &rhs) const { return real_ <= rhs.real_; }
+
+        constexpr bool operator>=(const dual_t &rhs) const { return real_ >= rhs.real_; }
+
+        /**
+         * Applies chain rule for scalar function g with value g(a) and derivative g'(a).
+         *
+         * @param value g(a)
+         * @param derivative g'(a)
+         * @return g(this)
+         */
+        dual_t chain(T value, T derivative) const {
+            dual_t tmp;
+            tmp.real_ = value;
+            for (size_t i = 0; i < D; ++i) tmp.dual_[i] = derivative * dual_[i];
+            return tmp;
+        }
+    };
+
+    template<typename T, size_t D>
+    dual_t<T, D> operator+(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return rhs.operator+(lhs); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> operator-(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return dual_t<T, D>(lhs).operator-(rhs); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> operator*(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return rhs.operator*(lhs); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> operator/(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return dual_t<T, D>(lhs).operator/(rhs); }
+
+    template<typename T, size_t D>
+    constexpr bool operator<(const dual_t<T, D> &lhs, const typename dual_t<T, D>::value_type &rhs) { return lhs.real() < rhs; }
+
+    template<typename T, size_t D>
+    constexpr bool operator>(const dual_t<T, D> &lhs, const typename dual_t<T, D>::value_type &rhs) { return lhs.real() > rhs; }
+
+    template<typename T, size_t D>
+    constexpr bool operator<(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return lhs < rhs.real(); }
+
+    template<typename T, size_t D>
+    constexpr bool operator>(const typename dual_t<T, D>::value_type &lhs, const dual_t<T, D> &rhs) { return lhs > rhs.real(); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> sqrt(const dual_t<T, D> &a) {
+        const T s = sqrt(a.real());
+        return a.chain(s, s > 0 ? 1 / (2 * s) : 0);
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> exp(const dual_t<T, D> &a) {
+        const T e = exp(a.real());
+        return a.chain(e, e);
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> log(const dual_t<T, D> &a) { return a.chain(log(a.real()), 1 / a.real()); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> sin(const dual_t<T, D> &a) { return a.chain(sin(a.real()), cos(a.real())); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> cos(const dual_t<T, D> &a) { return a.chain(cos(a.real()), -sin(a.real())); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> tan(const dual_t<T, D> &a) {
+        const T t = tan(a.real());
+        return a.chain(t, 1 + t * t);
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> asin(const dual_t<T, D> &a) {
+        return a.chain(asin(a.real()), 1 / sqrt(1 - a.real() * a.real()));
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> acos(const dual_t<T, D> &a) {
+        return a.chain(acos(a.real()), -1 / sqrt(1 - a.real() * a.real()));
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> atan(const dual_t<T, D> &a) { return a.chain(atan(a.real()), 1 / (1 + a.real() * a.real())); }
+
+    template<typename T, size_t D>
+    dual_t<T, D> atan2(const dual_t<T, D> &y, const dual_t<T, D> &x) {
+        const T r2 = x.real() * x.real() + y.real() * y.real();
+        dual_t<T, D> tmp(atan2(y.real(), x.real()));
+        for (size_t i = 0; i < D; ++i) tmp.dual(i) = (x.real() * y.dual(i) - y.real() * x.dual(i)) / r2;
+        return tmp;
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> pow(const dual_t<T, D> &a, const typename dual_t<T, D>::value_type &n) {
+        return a.chain(pow(a.real(), n), n * pow(a.real(), n - 1));
+    }
+
+    template<typename T, size_t D>
+    dual_t<T, D> abs(const dual_t<T, D> &a) { return a.real() < 0 ? -a : a; }
+
+    template<typename T, size_t D>
+    dual_t<T, D> fabs(const dual_t<T, D> &a) { return abs(a); }
+
+    template<size_t D = 1>
+    using dual_number = dual_t<real_t, D>;
+
+    /**
+     * Seeds x as dual vector with direction i on x_i.
+     *
+     * @tparam T
+     * @tparam N
+     * @param x Point of evaluation
+     * @return Dual vector
+     */
+    template<typename T, size_t N>
+    generic_vector<dual_t<T, N>, N> make_dual_vector(const generic_vector<T, N> &x) {
+        generic_vector<dual_t<T, N>, N> result;
+        for (size_t i = 0; i < N; ++i) result[i] = dual_t<T, N>(x[i], i);
+        return result;
+    }
+
+    /**
+     * Extracts the value part of a dual vector.
+     *
+     * @tparam T
+     * @tparam D
+     * @tparam N
+     * @param v Dual vector
+     * @return Value vector
+     */
+    template<typename T, size_t D, size_t N>
+    generic_vector<T, N> dual_value(const generic_vector<dual_t<T, D>, N> &v) {
+        generic_vector<T, N> result;
+        for (size_t i = 0; i < N; ++i) result[i] = v[i].real();
+        return result;
+    }
+
+    /**
+     * Extracts the Jacobian of a dual vector, one column per direction.
+     *
+     * @tparam T
+     * @tparam D
+     * @tparam N
+     * @param v Dual vector
+     * @return N x D Jacobian
+     */
+    template<typename T, size_t D, size_t N>
+    generic_matrix<T, N, D> dual_jacobian(const generic_vector<dual_t<T, D>, N> &v) {
+        generic_matrix<T, N, D> result;
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = 0; j < D; ++j) result[i][j] = v[i].dual(j);
+        return result;
+    }
+}  // namespace vt
+
+#endif  //VT_LINALG_DUAL_NUMBER_H
@@ -0,0 +1,254 @@
+/**
+ * @file ensemble_kalman.h
+ * @brief Ensemble transform Kalman filter for large-state models
+ */
+
+#ifndef VT_LINALG_ENSEMBLE_KALMAN_H
+#define VT_LINALG_ENSEMBLE_KALMAN_H
+
+#include "kalman.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "random.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Ensemble transform Kalman filter (ETKF).\n
+     * Uncertainty is carried by Members states stored contiguously, so no N x N covariance is propagated.
+     * The forecast runs f on every member and adds process noise drawn through the Cholesky factor of Q
+     * (only its diagonal when Q is diagonal), one generator per (seed, step, member); with OpenMP the members
+     * are forecast in parallel. The analysis works in the Members-dimensional ensemble space:
+     * with anomalies A = X - x_mean and whitened observation anomalies W = L_R^-1 (h(X) - y_mean),
+     * T = (K - 1) / rho I + W^T W = V D V^T by Jacobi rotations, w_mean = V D^-1 V^T W^T L_R^-1 (z - y_mean),
+     * W_a = sqrt(K - 1) V D^-1/2 V^T and X_a = x_mean + A (w_mean + W_a), costing O(N K^2 + M K^2 + K^3).
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Members Number of ensemble members
+     * @tparam StateFunc Callable as f(x, u) returning numeric_vector<N>, as for extended_kalman_filter_t
+     * @tparam ObservationFunc Callable as h(x) returning numeric_vector<M>, as for extended_kalman_filter_t
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension, size_t Members,
+             typename StateFunc       = detail::state_func_t<StateVectorDimension, ControlVectorDimension>,
+             typename ObservationFunc = detail::observation_func_t<StateVectorDimension, MeasurementVectorDimension>>
+    class ensemble_kalman_filter_t {
+    public:
+        static_assert(Members > 1, "Ensemble needs at least two members.");
+
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+        static constexpr size_t K_ = Members;                     // Alias
+
+    protected:
+        StateFunc f_;                    // state-transition function
+        ObservationFunc h_;              // observation function
+        numeric_matrix<N_, N_> sqrt_Q_;  // Cholesky factor of the process noise covariance
+        numeric_matrix<M_, M_> sqrt_R_;  // Cholesky factor of the measurement noise covariance
+        bool diagonal_Q_;                // sample process noise from the diagonal only
+        numeric_vector<N_> X_[K_];       // ensemble members
+        numeric_vector<M_> Y_[K_];       // whitened observation anomalies workspace
+        numeric_vector<N_> x_mean_;      // ensemble mean
+        real_t rho_;                     // multiplicative covariance inflation
+        uint64_t seed_;                  // base seed of per-member generators
+        uint64_t step_;                  // number of forecasts
+
+    public:
+        /**
+         * Ensemble Kalman filter constructor, draws members from N(x_0, diag(sigma_0^2))
+         *
+         * @param f_vec_func state-transition function
+         * @param h_vec_func observation function
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @param sigma_0 initial standard deviation of each state component
+         * @param seed random seed
+         */
+        ensemble_kalman_filter_t(StateFunc f_vec_func, ObservationFunc h_vec_func,
+                                 const numeric_matrix<N_, N_> &Q_matrix,
+                                 const numeric_matrix<M_, M_> &R_matrix,
+                                 const numeric_vector<N_> &x_0,
+                                 const numeric_vector<N_> &sigma_0,
+                                 uint64_t seed = 1)
+            : f_(f_vec_func), h_(h_vec_func),
+              sqrt_Q_{Q_matrix.cholesky()}, sqrt_R_{R_matrix.cholesky()}, diagonal_Q_{Q_matrix.is_diagonal()},
+              x_mean_{x_0}, rho_{1.}, seed_{splitmix64(seed)}, step_{0} {
+            xorshift_t rng(seed);
+            for (size_t k = 0; k < K_; ++k)
+                for (size_t i = 0; i < N_; ++i) X_[k][i] = rng.normal(x_0[i], sigma_0[i]);
+            mean();
+        }
+
+        /**
+         * Forecast of every member with additive process noise
+         *
+         * @param u control input vector
+         */
+        ensemble_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            const uint64_t base_ = splitmix64(seed_ ^ splitmix64(step_));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (size_t k = 0; k < K_; ++k) {
+                xorshift_t rng_k(base_ + k);
+                X_[k] = f_(X_[k], u);
+                if (diagonal_Q_) {
+                    for (size_t i = 0; i < N_; ++i) X_[k][i] += sqrt_Q_[i][i] * rng_k.normal();
+                } else {
+                    numeric_vector<N_> xi_;
+                    for (size_t i = 0; i < N_; ++i) xi_[i] = rng_k.normal();
+                    for (size_t i = 0; i < N_; ++i)
+                        for (size_t j = 0; j <= i; ++j) X_[k][i] += sqrt_Q_[i][j] * xi_[j];
+                }
+            }
+            ++step_;
+            mean();
+            return *this;
+        }
+
+        /**
+         * Analysis in ensemble space
+         *
+         * @param z Measurement vector
+         */
+        ensemble_kalman_filter_t &update(const numeric_vector<M_> &z) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (size_t k = 0; k < K_; ++k) Y_[k] = h_(X_[k]);
+
+            numeric_vector<M_> y_mean_;
+            for (size_t k = 0; k < K_; ++k) y_mean_ += Y_[k];
+            y_mean_ /= static_cast<real_t>(K_);
+            for (size_t k = 0; k < K_; ++k) Y_[k] = vt::move(sqrt_R_.solve_lower(Y_[k] - y_mean_));
+            const numeric_vector<M_> d_ = vt::move(sqrt_R_.solve_lower(z - y_mean_));
+
+            // T = (K - 1) / rho I + W^T W, c = W^T d
+            const real_t k_1 = static_cast<real_t>(K_ - 1);
+            numeric_matrix<K_, K_> T_;
+            numeric_vector<K_> c_;
+            for (size_t i = 0; i < K_; ++i) {
+                for (size_t j = i; j < K_; ++j) T_[i][j] = T_[j][i] = Y_[i].dot(Y_[j]);
+                T_[i][i] += k_1 / rho_;
+                c_[i] = Y_[i].dot(d_);
+            }
+
+            const numeric_matrix_eigen<K_> eig_ = T_.eigen_symmetric();
+            const numeric_matrix<K_, K_> &V_    = eig_.vectors();
+            const numeric_vector<K_> &D_        = eig_.values();
+
+            // w_mean = V D^-1 V^T c, W_a = sqrt(K - 1) V D^-1/2 V^T
+            numeric_vector<K_> Vtc_ = vt::move(V_.transpose() * c_);
+            numeric_matrix<K_, K_> V_s;
+            for (size_t j = 0; j < K_; ++j) {
+                Vtc_[j] /= D_[j];
+                const real_t s_j = sqrt(k_1 / D_[j]);
+                for (size_t i = 0; i < K_; ++i) V_s[i][j] = V_[i][j] * s_j;
+            }
+            const numeric_vector<K_> w_mean_ = vt::move(V_ * Vtc_);
+            numeric_matrix<K_, K_> W_a       = vt::move(V_s.matmul_T(V_));
+            for (size_t i = 0; i < K_; ++i)
+                for (size_t k = 0; k < K_; ++k) W_a[i][k] += w_mean_[i];
+
+            // X_a = x_mean + A (w_mean 1^T + W_a), members become anomalies first
+            for (size_t k = 0; k < K_; ++k) X_[k] -= x_mean_;
+            transform(W_a);
+            mean();
+            return *this;
+        }
+
+        ensemble_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+            return predict().update(z);
+        }
+
+        template<typename... Ts>
+        ensemble_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+        /**
+         * Sets multiplicative covariance inflation applied in the analysis
+         *
+         * @param rho Inflation factor, 1 for none
+         */
+        ensemble_kalman_filter_t &set_inflation(const real_t &rho) {
+            rho_ = rho;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr real_t inflation() const { return rho_; }
+
+        /**
+         * Ensemble mean
+         *
+         * @return State estimate
+         */
+        const numeric_vector<N_> &state_vector() const { return x_mean_; }
+
+        /**
+         * Sample covariance of the ensemble, O(N^2 K)
+         *
+         * @return State covariance
+         */
+        numeric_matrix<N_, N_> covariance() const {
+            numeric_matrix<N_, N_> P;
+            for (size_t k = 0; k < K_; ++k) {
+                const numeric_vector<N_> a_ = vt::move(X_[k] - x_mean_);
+                for (size_t i = 0; i < N_; ++i)
+                    for (size_t j = 0; j < N_; ++j) P[i][j] += a_[i] * a_[j];
+            }
+            return P * (1. / static_cast<real_t>(K_ - 1));
+        }
+
+        const numeric_vector<N_> &member(size_t k) const { return X_[k]; }
+
+        [[nodiscard]] static constexpr size_t size() { return K_; }
+
+    private:
+        void mean() {
+            x_mean_ = numeric_vector<N_>();
+            for (size_t k = 0; k < K_; ++k) x_mean_ += X_[k];
+            x_mean_ /= static_cast<real_t>(K_);
+        }
+
+        /**
+         * X[k] <- x_mean + sum_j A[j] W[j][k], with X holding the anomalies A on entry.
+         * Works one state component at a time so only K scratch values are needed.
+         */
+        void transform(const numeric_matrix<K_, K_> &W) {
+            numeric_vector<K_> a_i;
+            for (size_t i = 0; i < N_; ++i) {
+                for (size_t j = 0; j < K_; ++j) a_i[j] = X_[j][i];
+                for (size_t k = 0; k < K_; ++k) {
+                    real_t acc_ = x_mean_[i];
+                    for (size_t j = 0; j < K_; ++j) acc_ += a_i[j] * W[j][k];
+                    X_[k][i] = acc_;
+                }
+            }
+        }
+    };
+
+    /**
+     * Creates ensemble Kalman filter from any f and h callables, e.g. lambdas.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam Members Number of ensemble members
+     * @tparam StateFunc
+     * @tparam ObservationFunc
+     * @return Ensemble Kalman filter
+     */
+    template<size_t N, size_t M, size_t L, size_t Members, typename StateFunc, typename ObservationFunc>
+    ensemble_kalman_filter_t<N, M, L, Members, StateFunc, ObservationFunc>
+    make_ensemble_kalman_filter(StateFunc f_vec_func, ObservationFunc h_vec_func,
+                                const numeric_matrix<N, N> &Q_matrix, const numeric_matrix<M, M> &R_matrix,
+                                const numeric_vector<N> &x_0, const numeric_vector<N> &sigma_0,
+                                uint64_t seed = 1) {
+        return {f_vec_func, h_vec_func, Q_matrix, R_matrix, x_0, sigma_0, seed};
+    }
+}  // namespace vt
+
+#endif  //VT_LINALG_ENSEMBLE_KALMAN_H
@@ -12,121 +12,1530 @@
 #ifndef VT_LINALG_KALMAN_H
 #define VT_LINALG_KALMAN_H
 
+#include "bounded_numeric_matrix.h"
+#include "circular_buffer.h"
+#include "dual_number.h"
+#include "kronecker.h"
 #include "numeric_matrix.h"
 #include "numeric_vector.h"
 #include "standard_utility.h"
 
 namespace vt {
-    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
-    class kalman_filter_t {
+    namespace detail {
+        /**
+         * Scalar measurement update x += k y, P -= k (P h)^T with k = P h / (h^T P h + r).
+         *
+         * @tparam N State vector dimension
+         * @param x State vector
+         * @param P State covariance
+         * @param h Measurement row
+         * @param y Scalar innovation
+         * @param r Scalar measurement noise variance
+         */
+        template<size_t N>
+        void scalar_update(numeric_vector<N> &x, numeric_matrix<N, N> &P,
+                           const numeric_vector<N> &h, const real_t &y, const real_t &r) {
+            const numeric_vector<N> Ph = vt::move(P * h);
+            const real_t s             = h.dot(Ph) + r;
+            const numeric_vector<N> k  = vt::move(Ph / s);
+            x += k * y;
+            for (size_t i = 0; i < N; ++i)
+                for (size_t j = 0; j < N; ++j) P[i][j] -= k[i] * Ph[j];
+        }
+
+        /**
+         * Covariance prediction F P F^T + Q.
+         *
+         * @tparam N State vector dimension
+         * @param F State-transition model
+         * @param P State covariance
+         * @param Q Covariance of the process noise
+         * @return Predicted state covariance
+         */
+        template<size_t N>
+        numeric_matrix<N, N> covariance_predict(const numeric_matrix<N, N> &F, const numeric_matrix<N, N> &P,
+                                                const numeric_matrix<N, N> &Q) {
+            return F * P.matmul_T(F) + Q;
+        }
+
+        /**
+         * Transposed gain K^T = S^-1 H P of a full update, solved through the Cholesky factor of S.
+         *
+         * @tparam N State vector dimension
+         * @tparam M Measurement vector dimension
+         * @param P_H_t P H^T
+         * @param L_S Cholesky factor of the innovation covariance S = H P H^T + R
+         * @return Transposed gain
+         */
+        template<size_t N, size_t M>
+        numeric_matrix<M, N> cholesky_gain(const numeric_matrix<N, M> &P_H_t, const numeric_matrix<M, M> &L_S) {
+            return L_S.cholesky_solve(P_H_t.transpose());
+        }
+
+        /**
+         * Full measurement update x += K y, P -= P H^T K^T with the transposed gain K^T = S^-1 H P
+         * solved through the Cholesky factor of S.
+         *
+         * @tparam N State vector dimension
+         * @tparam M Measurement vector dimension
+         * @param x State vector
+         * @param P State covariance
+         * @param P_H_t P H^T
+         * @param L_S Cholesky factor of the innovation covariance S = H P H^T + R
+         * @param y Innovation
+         * @return Transposed gain
+         */
+        template<size_t N, size_t M>
+        numeric_matrix<M, N> cholesky_update(numeric_vector<N> &x, numeric_matrix<N, N> &P, const numeric_matrix<N, M> &P_H_t,
+                                             const numeric_matrix<M, M> &L_S, const numeric_vector<M> &y) {
+            numeric_matrix<M, N> K_t = vt::move(cholesky_gain(P_H_t, L_S));
+            x += K_t.transpose() * y;
+            P -= P_H_t * K_t;
+            return K_t;
+        }
+    }  // namespace detail
+
+    /**
+     * Function value and its Jacobian evaluated at the same point.\n
+     * Returned by combined evaluators passed to extended_kalman_filter_t in place of a Jacobian.
+     *
+     * @tparam Row Output dimension
+     * @tparam Col Input dimension
+     */
+    template<size_t Row, size_t Col>
+    struct linearization_t {
+        numeric_vector<Row> value;
+        numeric_matrix<Row, Col> jacobian;
+    };
+
+    namespace detail {
+        template<size_t N, size_t L>
+        using state_func_t = numeric_vector<N> (*)(const numeric_vector<N> &x, const numeric_vector<L> &u);
+
+        template<size_t N, size_t L>
+        using state_jacobian_t = numeric_matrix<N, N> (*)(const numeric_vector<N> &x, const numeric_vector<L> &u);
+
+        template<size_t N, size_t M>
+        using observation_func_t = numeric_vector<M> (*)(const numeric_vector<N> &x);
+
+        template<size_t N, size_t M>
+        using observation_jacobian_t = numeric_matrix<M, N> (*)(const numeric_vector<N> &x);
+
+        /**
+         * Placeholder model type for filters driven only by combined evaluators.
+         */
+        struct no_func_t {};
+
+        /**
+         * Passes through the result of a combined evaluator.
+         */
+        template<typename Func, size_t Row, size_t Col, typename... Args>
+        linearization_t<Row, Col> linearize(const Func &, linearization_t<Row, Col> &&lin, const Args &...) {
+            return vt::move(lin);
+        }
+
+        /**
+         * Pairs a Jacobian with the model value evaluated at the same arguments.
+         */
+        template<typename Func, size_t Row, size_t Col, typename... Args>
+        linearization_t<Row, Col> linearize(const Func &func, numeric_matrix<Row, Col> &&jacobian, const Args &...args) {
+            return {func(args...), vt::move(jacobian)};
+        }
+
+        /**
+         * Combined evaluator of f(x, u) and its Jacobian by forward-mode automatic differentiation.\n
+         * Func is called once with x as generic_vector<dual_t<real_t, N>, N> and u as numeric_vector<L>.
+         */
+        template<size_t N, size_t L, typename Func>
+        struct autodiff_state_t {
+            Func f;
+
+            linearization_t<N, N> operator()(const numeric_vector<N> &x, const numeric_vector<L> &u) const {
+                const generic_vector<dual_t<real_t, N>, N> fx = f(make_dual_vector(x), u);
+                return {dual_value(fx), dual_jacobian(fx)};
+            }
+        };
+
+        /**
+         * Combined evaluator of h(x) and its Jacobian by forward-mode automatic differentiation.\n
+         * Func is called once with x as generic_vector<dual_t<real_t, N>, N>.
+         */
+        template<size_t N, size_t M, typename Func>
+        struct autodiff_observation_t {
+            Func h;
+
+            linearization_t<M, N> operator()(const numeric_vector<N> &x) const {
+                const generic_vector<dual_t<real_t, N>, M> hx = h(make_dual_vector(x));
+                return {dual_value(hx), dual_jacobian(hx)};
+            }
+        };
+
+        /**
+         * Default diagnostics policy of kalman_filter_core_t, records nothing.\n
+         * A policy provides enabled and record(y, L_S, nis), called by every standard and sequential update
+         * with the innovation, the Cholesky factor of its covariance and the normalized innovation squared.
+         * Filters derive from the policy, so this empty one adds neither storage nor work.
+         */
+        struct no_diagnostics_t {
+            static constexpr bool enabled = false;
+
+            template<size_t M>
+            void record(const numeric_vector<M> &, const numeric_matrix<M, M> &, const real_t &) {}
+        };
+    }  // namespace detail
+
+    /**
+     * Policies of kalman_filter_core_t.\n
+     * Model: linear_model_t or extended_model_t, how the state is propagated and observed.\n
+     * Noise: bound_noise_t, shared_noise_t or owned_noise_t, how Q and R are stored.\n
+     * Adaptation: no_adaptation_t, ema_adaptation_t or windowed_adaptation_t, how Q and R are re-estimated.\n
+     * Update form: standard_update_t, joseph_update_t, sequential_update_t or selectable_update_t.
+     */
+    namespace policy {
+        /**
+         * Linear control input and measurement shared by the linear models, B and H bound by reference
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam ControlVectorDimension Control vector dimension
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
+        class linear_observation_t {
+        public:
+            static constexpr bool is_linear = true;
+
+            static constexpr size_t state_dimension       = StateVectorDimension;
+            static constexpr size_t measurement_dimension = MeasurementVectorDimension;
+            static constexpr size_t control_dimension     = ControlVectorDimension;
+
+        private:
+            // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+            static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        protected:
+            const numeric_matrix<N_, L_> &B_;  // control-input model
+            const numeric_matrix<M_, N_> &H_;  // measurement model
+
+        public:
+            constexpr linear_observation_t(const numeric_matrix<N_, L_> &B_matrix, const numeric_matrix<M_, N_> &H_matrix)
+                : B_{B_matrix}, H_{H_matrix} {}
+
+        protected:
+            numeric_vector<M_> observe(const numeric_vector<N_> &x) const { return H_ * x; }
+
+            const numeric_matrix<M_, N_> &observation_jacobian() const { return H_; }
+
+            /**
+             * Measurement of the model linearized at x, so that the innovation of any state x' is
+             * z_lin - H x'. For a linear model this is z itself.
+             */
+            const numeric_vector<M_> &linearized_measurement(const numeric_vector<M_> &z, const numeric_vector<N_> &) const {
+                return z;
+            }
+
+            const numeric_vector<M_> &linearized_measurement(const numeric_vector<M_> &z, const numeric_vector<N_> &,
+                                                             const numeric_vector<M_> &) const {
+                return z;
+            }
+        };
+
+        /**
+         * Linear model x' = F x + B u, z = H x, with all matrices bound by reference
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam ControlVectorDimension Control vector dimension
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
+        class linear_model_t : public linear_observation_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension> {
+        private:
+            using base_t = linear_observation_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension>;
+
+            // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+            static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        public:
+            using transition_arg_t = const numeric_matrix<N_, N_> &;
+
+        protected:
+            const numeric_matrix<N_, N_> *F_;  // state-transition model
+
+        public:
+            constexpr linear_model_t(const numeric_matrix<N_, N_> &F_matrix,
+                                     const numeric_matrix<N_, L_> &B_matrix,
+                                     const numeric_matrix<M_, N_> &H_matrix)
+                : base_t(B_matrix, H_matrix), F_{&F_matrix} {}
+
+            /**
+             * State-transition model used by predict(), as bound by the constructor or use_model()
+             *
+             * @return State-transition model
+             */
+            const numeric_matrix<N_, N_> &transition() const { return *F_; }
+
+        protected:
+            void bind_transition(const numeric_matrix<N_, N_> &F_matrix) { F_ = &F_matrix; }
+
+            /**
+             * x = F x + B u, P = F P F^T + Q
+             */
+            void propagate(numeric_vector<N_> &x, numeric_matrix<N_, N_> &P, const numeric_vector<L_> &u,
+                           const numeric_matrix<N_, N_> &Q) {
+                x = vt::move(*F_ * x + base_t::B_ * u);
+                P = vt::move(detail::covariance_predict(*F_, P, Q));
+            }
+        };
+
+        /**
+         * Linear model whose state-transition operator is applied in place instead of stored as F,
+         * e.g. vdt with its Toeplitz structure. Transition must provide propagate(x),
+         * propagate_covariance(P) and generate_F(), and is bound by reference so it follows changes of dt.
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam ControlVectorDimension Control vector dimension
+         * @tparam Transition State-transition operator
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+                 typename Transition>
+        class structured_model_t : public linear_observation_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension> {
+        private:
+            using base_t = linear_observation_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension>;
+
+            // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+            static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        public:
+            using transition_arg_t = const Transition &;
+
+        protected:
+            const Transition &T_;  // state-transition operator
+
+        public:
+            constexpr structured_model_t(const Transition &transition,
+                                         const numeric_matrix<N_, L_> &B_matrix,
+                                         const numeric_matrix<M_, N_> &H_matrix)
+                : base_t(B_matrix, H_matrix), T_{transition} {}
+
+            /**
+             * State-transition model at the current state of the operator, materialized on request only
+             *
+             * @return State-transition model
+             */
+            numeric_matrix<N_, N_> transition() const { return T_.generate_F(); }
+
+        protected:
+            /**
+             * x = F x + B u, P = F P F^T + Q through the operator
+             */
+            void propagate(numeric_vector<N_> &x, numeric_matrix<N_, N_> &P, const numeric_vector<L_> &u,
+                           const numeric_matrix<N_, N_> &Q) {
+                T_.propagate(x);
+                x += base_t::B_ * u;
+                T_.propagate_covariance(P);
+                P += Q;
+            }
+        };
+
+        /**
+         * Nonlinear model x' = f(x, u), z = h(x), linearized by Jacobians or combined evaluators
+         * returning linearization_t
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam ControlVectorDimension Control vector dimension
+         * @tparam StateFunc State-transition model, detail::no_func_t with a combined evaluator
+         * @tparam StateJacobian State-transition Jacobian or combined evaluator
+         * @tparam ObservationFunc Measurement model, detail::no_func_t with a combined evaluator
+         * @tparam ObservationJacobian Measurement Jacobian or combined evaluator
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+                 typename StateFunc           = detail::state_func_t<StateVectorDimension, ControlVectorDimension>,
+                 typename StateJacobian       = detail::state_jacobian_t<StateVectorDimension, ControlVectorDimension>,
+                 typename ObservationFunc     = detail::observation_func_t<StateVectorDimension, MeasurementVectorDimension>,
+                 typename ObservationJacobian = detail::observation_jacobian_t<StateVectorDimension, MeasurementVectorDimension>>
+        class extended_model_t {
+        public:
+            static constexpr bool is_linear = false;
+
+            static constexpr size_t state_dimension       = StateVectorDimension;
+            static constexpr size_t measurement_dimension = MeasurementVectorDimension;
+            static constexpr size_t control_dimension     = ControlVectorDimension;
+
+        private:
+            // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+            static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        public:
+            using state_func_t           = StateFunc;
+            using state_jacobian_t       = StateJacobian;
+            using observation_func_t     = ObservationFunc;
+            using observation_jacobian_t = ObservationJacobian;
+
+        protected:
+            state_func_t f_;              // state-transition model
+            state_jacobian_t Fj_;         // state-transition Jacobian, or combined evaluator of f and Jacobian
+            observation_func_t h_;        // measurement model
+            observation_jacobian_t Hj_;   // measurement Jacobian, or combined evaluator of h and Jacobian
+            numeric_matrix<N_, N_> Fjx_;  // state-transition Jacobian of the last prediction
+            numeric_matrix<M_, N_> Hjx_;  // measurement Jacobian of the last observation
+            size_t iterations_;           // iterations used by the last update_iterated()
+
+        public:
+            constexpr extended_model_t(const state_func_t &f_vec_func,
+                                       const state_jacobian_t &Fj_mat_func,
+                                       const observation_func_t &h_vec_func,
+                                       const observation_jacobian_t &Hj_mat_func)
+                : f_(f_vec_func), Fj_{Fj_mat_func}, h_{h_vec_func}, Hj_{Hj_mat_func},
+                  Fjx_{numeric_matrix<N_, N_>::identity()}, Hjx_{}, iterations_{0} {}
+
+            constexpr extended_model_t(const state_jacobian_t &f_lin_func,
+                                       const observation_jacobian_t &h_lin_func)
+                : f_{}, Fj_{f_lin_func}, h_{}, Hj_{h_lin_func},
+                  Fjx_{numeric_matrix<N_, N_>::identity()}, Hjx_{}, iterations_{0} {}
+
+            /**
+             * State-transition Jacobian evaluated by the last predict()
+             *
+             * @return State-transition Jacobian
+             */
+            const numeric_matrix<N_, N_> &transition() const { return Fjx_; }
+
+            /**
+             * Number of iterations used by the last update_iterated()
+             *
+             * @return Iteration count
+             */
+            [[nodiscard]] constexpr size_t iterations() const { return iterations_; }
+
+        protected:
+            /**
+             * x = f(x, u), P = Fj P Fj^T + Q with Fj evaluated at the prior
+             */
+            void propagate(numeric_vector<N_> &x, numeric_matrix<N_, N_> &P, const numeric_vector<L_> &u,
+                           const numeric_matrix<N_, N_> &Q) {
+                linearization_t<N_, N_> f_lin_ = vt::move(detail::linearize(f_, Fj_(x, u), x, u));
+                x                              = vt::move(f_lin_.value);
+                Fjx_                           = vt::move(f_lin_.jacobian);
+                P                              = vt::move(detail::covariance_predict(Fjx_, P, Q));
+            }
+
+            /**
+             * Evaluates h(x) and keeps its Jacobian for observation_jacobian()
+             */
+            numeric_vector<M_> observe(const numeric_vector<N_> &x) {
+                linearization_t<M_, N_> h_lin_ = vt::move(detail::linearize(h_, Hj_(x), x));
+                Hjx_                           = vt::move(h_lin_.jacobian);
+                return vt::move(h_lin_.value);
+            }
+
+            const numeric_matrix<M_, N_> &observation_jacobian() const { return Hjx_; }
+
+            /**
+             * Measurement of the model linearized at x, z - h(x) + H x, so that the innovation
+             * of any state x' is z_lin - H x'
+             */
+            numeric_vector<M_> linearized_measurement(const numeric_vector<M_> &z, const numeric_vector<N_> &x) {
+                const numeric_vector<M_> z_pred_ = vt::move(observe(x));
+                return linearized_measurement(z, x, z_pred_);
+            }
+
+            numeric_vector<M_> linearized_measurement(const numeric_vector<M_> &z, const numeric_vector<N_> &x,
+                                                      const numeric_vector<M_> &z_pred) const {
+                return z - z_pred + Hjx_ * x;
+            }
+        };
+
+        /**
+         * Q and R bound by reference without copying, Q can be rebound by use_model()
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension>
+        class bound_noise_t {
+        public:
+            static constexpr bool is_mutable = false;
+
+        private:
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+        public:
+            using process_noise_arg_t     = const numeric_matrix<N_, N_> &;
+            using measurement_noise_arg_t = const numeric_matrix<M_, M_> &;
+
+        protected:
+            const numeric_matrix<N_, N_> *Q_;  // covariance of the process noise
+            const numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
+
+        public:
+            constexpr bound_noise_t(process_noise_arg_t Q_matrix, measurement_noise_arg_t R_matrix)
+                : Q_{&Q_matrix}, R_{R_matrix} {}
+
+            const numeric_matrix<N_, N_> &process_noise() const { return *Q_; }
+
+            const numeric_matrix<M_, M_> &measurement_noise() const { return R_; }
+
+        protected:
+            void bind_process_noise(const numeric_matrix<N_, N_> &Q_matrix) { Q_ = &Q_matrix; }
+        };
+
+        /**
+         * Q and R bound by mutable reference, adapted in place where the caller can see them
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension>
+        class shared_noise_t {
+        public:
+            static constexpr bool is_mutable = true;
+
+        private:
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+        public:
+            using process_noise_arg_t     = numeric_matrix<N_, N_> &;
+            using measurement_noise_arg_t = numeric_matrix<M_, M_> &;
+
+        protected:
+            numeric_matrix<N_, N_> &Q_;  // covariance of the process noise
+            numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
+
+        public:
+            constexpr shared_noise_t(process_noise_arg_t Q_matrix, measurement_noise_arg_t R_matrix)
+                : Q_{Q_matrix}, R_{R_matrix} {}
+
+            const numeric_matrix<N_, N_> &process_noise() const { return Q_; }
+
+            const numeric_matrix<M_, M_> &measurement_noise() const { return R_; }
+
+            const numeric_matrix<M_, M_> &R = R_;
+            const numeric_matrix<N_, N_> &Q = Q_;
+
+        protected:
+            numeric_matrix<N_, N_> &process_noise_storage() { return Q_; }
+
+            numeric_matrix<M_, M_> &measurement_noise_storage() { return R_; }
+        };
+
+        /**
+         * Q and R copied into the filter, adapted privately
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension>
+        class owned_noise_t {
+        public:
+            static constexpr bool is_mutable = true;
+
+        private:
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+        public:
+            using process_noise_arg_t     = const numeric_matrix<N_, N_> &;
+            using measurement_noise_arg_t = const numeric_matrix<M_, M_> &;
+
+        protected:
+            numeric_matrix<N_, N_> Q_;  // covariance of the process noise
+            numeric_matrix<M_, M_> R_;  // covariance of the measurement noise
+
+        public:
+            constexpr owned_noise_t(process_noise_arg_t Q_matrix, measurement_noise_arg_t R_matrix)
+                : Q_{Q_matrix}, R_{R_matrix} {}
+
+            const numeric_matrix<N_, N_> &process_noise() const { return Q_; }
+
+            const numeric_matrix<M_, M_> &measurement_noise() const { return R_; }
+
+        protected:
+            numeric_matrix<N_, N_> &process_noise_storage() { return Q_; }
+
+            numeric_matrix<M_, M_> &measurement_noise_storage() { return R_; }
+        };
+
+        /**
+         * Fixed Q and R
+         */
+        struct no_adaptation_t {
+            static constexpr bool enabled = false;
+
+            constexpr no_adaptation_t(const real_t &, const real_t &) {}
+        };
+
+        /**
+         * Exponential moving average of the innovation statistics,
+         * R = (1 - alpha) R + alpha (y y^T + S) and Q = (1 - beta) Q + beta (K y) (K y)^T
+         */
+        class ema_adaptation_t {
+        public:
+            static constexpr bool enabled = true;
+
+        protected:
+            const real_t alpha_;  // EMA Smoothing factor for R
+            const real_t beta_;   // EMA Smoothing factor for Q
+
+        public:
+            constexpr ema_adaptation_t(const real_t &alpha, const real_t &beta) : alpha_{alpha}, beta_{beta} {}
+
+        protected:
+            /**
+             * Adapts Q and R after a standard update
+             *
+             * @param y Innovation
+             * @param L_S Cholesky factor of the innovation covariance
+             * @param P Posterior state covariance
+             * @param K_t Transposed gain
+             * @param Q Covariance of the process noise
+             * @param R Covariance of the measurement noise
+             */
+            template<size_t N, size_t M>
+            void adapt(const numeric_vector<M> &y, const numeric_matrix<M, M> &L_S, const numeric_matrix<M, N> &,
+                       const numeric_matrix<N, N> &, const numeric_matrix<M, N> &K_t,
+                       numeric_matrix<N, N> &Q, numeric_matrix<M, M> &R) {
+                const numeric_vector<N> K_y = vt::move(K_t.transpose() * y);
+                R = (1 - alpha_) * R + alpha_ * (y.outer(y) + L_S.matmul_T(L_S));
+                Q = (1 - beta_) * Q + beta_ * K_y.outer(K_y);
+            }
+        };
+
+        /**
+         * Covariance matching over the latest Window updates,
+         * R = C_e + H P H^T from the post-fit residuals e = z - H x and Q = K C_y K^T from the innovations y.\n
+         * Sums of the outer products are kept incrementally, the estimates are blended in with weights
+         * alpha and beta (1 replaces Q and R) once the window is full.
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam Window Number of updates in the window
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t Window>
+        class windowed_adaptation_t {
+        public:
+            static_assert(Window > 0, "Window must not be empty.");
+
+            static constexpr bool enabled = true;
+
+        private:
+            static constexpr size_t N_ = StateVectorDimension;        // ALias
+            static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+        protected:
+            circular_buffer_static_t<numeric_vector<M_>, Window> y_;  // latest innovations
+            circular_buffer_static_t<numeric_vector<M_>, Window> e_;  // latest post-fit residuals
+            numeric_matrix<M_, M_> C_y_;                              // sum of y y^T over the window
+            numeric_matrix<M_, M_> C_e_;                              // sum of e e^T over the window
+            const real_t alpha_;                                      // blending weight for R
+            const real_t beta_;                                       // blending weight for Q
+
+        public:
+            constexpr windowed_adaptation_t(const real_t &alpha, const real_t &beta)
+                : C_y_{}, C_e_{}, alpha_{alpha}, beta_{beta} {}
+
+        protected:
+            /**
+             * Adapts Q and R after a standard update
+             *
+             * @param y Innovation
+             * @param H Measurement model or Jacobian
+             * @param P Posterior state covariance
+             * @param K_t Transposed gain
+             * @param Q Covariance of the process noise
+             * @param R Covariance of the measurement noise
+             */
+            void adapt(const numeric_vector<M_> &y, const numeric_matrix<M_, M_> &, const numeric_matrix<M_, N_> &H,
+                       const numeric_matrix<N_, N_> &P, const numeric_matrix<M_, N_> &K_t,
+                       numeric_matrix<N_, N_> &Q, numeric_matrix<M_, M_> &R) {
+                const numeric_vector<N_> K_y = vt::move(K_t.transpose() * y);
+                const numeric_vector<M_> e_k = vt::move(y - H * K_y);
+                if (y_.full()) {
+                    C_y_ -= y_.front().outer(y_.front());
+                    C_e_ -= e_.front().outer(e_.front());
+                }
+                y_.push_overwrite(y);
+                e_.push_overwrite(e_k);
+                C_y_ += y.outer(y);
+                C_e_ += e_k.outer(e_k);
+                if (!y_.full()) return;
+
+                constexpr real_t w_ = 1. / static_cast<real_t>(Window);
+                R = (1 - alpha_) * R + alpha_ * (w_ * C_e_ + H * P.matmul_T(H));
+                Q = (1 - beta_) * Q + beta_ * (K_t.transpose() * (w_ * C_y_) * K_t);
+            }
+        };
+
+        /**
+         * Full M x M update with P = P - K H P
+         */
+        struct standard_update_t {
+            static constexpr bool joseph     = false;
+            static constexpr bool sequential = false;
+            static constexpr bool selectable = false;
+
+            template<size_t M>
+            constexpr explicit standard_update_t(const numeric_matrix<M, M> &) {}
+
+            [[nodiscard]] static constexpr bool is_sequential() { return false; }
+        };
+
+        /**
+         * Full M x M update with the Joseph form P = (I - K H) P (I - K H)^T + K R K^T,
+         * symmetric and positive semi-definite under rounding at about twice the cost
+         */
+        struct joseph_update_t {
+            static constexpr bool joseph     = true;
+            static constexpr bool sequential = false;
+            static constexpr bool selectable = false;
+
+            template<size_t M>
+            constexpr explicit joseph_update_t(const numeric_matrix<M, M> &) {}
+
+            [[nodiscard]] static constexpr bool is_sequential() { return false; }
+        };
+
+        /**
+         * M scalar updates, requires diagonal R
+         */
+        struct sequential_update_t {
+            static constexpr bool joseph     = false;
+            static constexpr bool sequential = true;
+            static constexpr bool selectable = false;
+
+            template<size_t M>
+            constexpr explicit sequential_update_t(const numeric_matrix<M, M> &) {}
+
+            [[nodiscard]] static constexpr bool is_sequential() { return true; }
+        };
+
+        /**
+         * Standard or sequential update chosen at run time, sequential when R is diagonal at construction
+         */
+        class selectable_update_t {
+        public:
+            static constexpr bool joseph     = false;
+            static constexpr bool sequential = false;
+            static constexpr bool selectable = true;
+
+        protected:
+            bool sequential_;  // process measurements one scalar at a time
+
+        public:
+            template<size_t M>
+            constexpr explicit selectable_update_t(const numeric_matrix<M, M> &R_matrix)
+                : sequential_{R_matrix.is_diagonal()} {}
+
+            [[nodiscard]] constexpr bool is_sequential() const { return sequential_; }
+        };
+    }  // namespace policy
+
+    /**
+     * Discrete-time Kalman filter assembled from policies, see namespace policy.\n
+     * Every variant shares the same predict and update code and only instantiates what its policies use,
+     * e.g. no adaptation and no diagnostics add neither storage nor work.
+     * Every variant does hold the gating cache, the predicted measurement, P H^T and the Cholesky factor of S,
+     * which the standard update shares with innovation_factor(), mahalanobis() and spatial indexing.
+     * kalman_filter_t, adaptive_kalman_filter_t, extended_kalman_filter_t and adaptive_extended_kalman_filter_t
+     * are preset combinations.
+     *
+     * @tparam Model linear_model_t or extended_model_t
+     * @tparam Noise Storage of Q and R
+     * @tparam Adaptation Re-estimation of Q and R
+     * @tparam UpdateForm Measurement update form
+     * @tparam Diagnostics Innovation diagnostics policy, e.g. innovation_monitor_t, none by default
+     */
+    template<typename Model, typename Noise, typename Adaptation, typename UpdateForm,
+             typename Diagnostics = detail::no_diagnostics_t>
+    class kalman_filter_core_t : public Model, public Noise, public UpdateForm, protected Adaptation, private Diagnostics {
+    public:
+        static_assert(!Adaptation::enabled || Noise::is_mutable,
+                      "Noise adaptation needs mutable storage, e.g. shared_noise_t or owned_noise_t.");
+        static_assert(!Adaptation::enabled || (!UpdateForm::sequential && !UpdateForm::selectable),
+                      "Noise adaptation needs the full innovation covariance, e.g. standard_update_t or joseph_update_t.");
+
+    private:
+        // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
+        static constexpr size_t N_ = Model::state_dimension;        // ALias
+        static constexpr size_t M_ = Model::measurement_dimension;  // Alias
+        static constexpr size_t L_ = Model::control_dimension;      // Alias
+
+    protected:
+        numeric_vector<N_> x_;          // state vector
+        numeric_matrix<N_, N_> P_;      // state covariance, self-initialized as Q
+        numeric_vector<M_> z_pred_;     // predicted measurement h(x) at the current prior
+        numeric_matrix<N_, M_> P_H_t_;  // P H^T at the current prior
+        numeric_matrix<M_, M_> L_S_;    // Cholesky factor of the innovation covariance S = H P H^T + R
+        bool factored_;                 // whether z_pred_, P_H_t_ and L_S_ match the current prior
+
+    public:
+        /**
+         * Linear Kalman filter constructor
+         *
+         * @param F_matrix state-transition model, or operator with structured_model_t
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @param alpha Adaptation factor for R, unused without adaptation
+         * @param beta Adaptation factor for Q, unused without adaptation
+         */
+        template<typename Model_ = Model, vt::enable_if_t<Model_::is_linear, int> = 0>
+        constexpr kalman_filter_core_t(
+                typename Model_::transition_arg_t F_matrix,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<M_, N_> &H_matrix,
+                typename Noise::process_noise_arg_t Q_matrix,
+                typename Noise::measurement_noise_arg_t R_matrix,
+                const numeric_vector<N_> &x_0,
+                const real_t &alpha = 0.1,
+                const real_t &beta  = 0.1)
+            : Model(F_matrix, B_matrix, H_matrix), Noise(Q_matrix, R_matrix), UpdateForm(R_matrix),
+              Adaptation(alpha, beta), x_{x_0}, P_{Q_matrix}, factored_{false} {}
+
+        /**
+         * Extended Kalman filter constructor from models and their Jacobians
+         *
+         * @param f_vec_func state-transition model
+         * @param Fj_mat_func state-transition Jacobian
+         * @param h_vec_func measurement model
+         * @param Hj_mat_func measurement Jacobian
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @param alpha Adaptation factor for R, unused without adaptation
+         * @param beta Adaptation factor for Q, unused without adaptation
+         */
+        template<typename Model_ = Model, vt::enable_if_t<!Model_::is_linear, int> = 0>
+        constexpr kalman_filter_core_t(
+                const typename Model_::state_func_t &f_vec_func,
+                const typename Model_::state_jacobian_t &Fj_mat_func,
+                const typename Model_::observation_func_t &h_vec_func,
+                const typename Model_::observation_jacobian_t &Hj_mat_func,
+                typename Noise::process_noise_arg_t Q_matrix,
+                typename Noise::measurement_noise_arg_t R_matrix,
+                const numeric_vector<N_> &x_0,
+                const real_t &alpha = 0.1,
+                const real_t &beta  = 0.1)
+            : Model(f_vec_func, Fj_mat_func, h_vec_func, Hj_mat_func), Noise(Q_matrix, R_matrix), UpdateForm(R_matrix),
+              Adaptation(alpha, beta), x_{x_0}, P_{Q_matrix}, factored_{false} {}
+
+        /**
+         * Extended Kalman filter constructor from combined evaluators, each returning
+         * linearization_t with the model value and its Jacobian from one call.
+         *
+         * @param f_lin_func state-transition model and Jacobian, linearization_t<N, N>(x, u)
+         * @param h_lin_func measurement model and Jacobian, linearization_t<M, N>(x)
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @param alpha Adaptation factor for R, unused without adaptation
+         * @param beta Adaptation factor for Q, unused without adaptation
+         */
+        template<typename Model_ = Model, vt::enable_if_t<!Model_::is_linear, int> = 0>
+        constexpr kalman_filter_core_t(
+                const typename Model_::state_jacobian_t &f_lin_func,
+                const typename Model_::observation_jacobian_t &h_lin_func,
+                typename Noise::process_noise_arg_t Q_matrix,
+                typename Noise::measurement_noise_arg_t R_matrix,
+                const numeric_vector<N_> &x_0,
+                const real_t &alpha = 0.1,
+                const real_t &beta  = 0.1)
+            : Model(f_lin_func, h_lin_func), Noise(Q_matrix, R_matrix), UpdateForm(R_matrix),
+              Adaptation(alpha, beta), x_{x_0}, P_{Q_matrix}, factored_{false} {}
+
+        /**
+         * Copy constructor, state_vector and state refer to the copy
+         */
+        constexpr kalman_filter_core_t(const kalman_filter_core_t &other)
+            : Model(other), Noise(other), UpdateForm(other), Adaptation(other), Diagnostics(other),
+              x_{other.x_}, P_{other.P_}, z_pred_{other.z_pred_}, P_H_t_{other.P_H_t_}, L_S_{other.L_S_},
+              factored_{other.factored_} {}
+
+        /**
+         * Kalman filter prediction
+         *
+         * @param u control input vector
+         */
+        kalman_filter_core_t &predict(const numeric_vector<L_> &u = {}) {
+            Model::propagate(x_, P_, u, Noise::process_noise());
+            factored_ = false;
+            return *this;
+        }
+
+        /**
+         * Kalman filter prediction with a structured state-transition operator in place of F_.\n
+         * Transition must provide propagate(x) and propagate_covariance(P), applying F in place.
+         *
+         * @tparam Transition
+         * @param transition state-transition operator
+         * @param u control input vector
+         */
+        template<typename Transition>
+        kalman_filter_core_t &predict_with(const Transition &transition, const numeric_vector<L_> &u = {}) {
+            static_assert(Model::is_linear, "predict_with() needs a linear model.");
+            transition.propagate(x_);
+            x_ += Model::B_ * u;
+            transition.propagate_covariance(P_);
+            P_ += Noise::process_noise();
+            factored_ = false;
+            return *this;
+        }
+
+        /**
+         * Rebinds the state-transition model and the process noise covariance without copying,
+         * e.g. to switch between precomputed models for a new dt.\n
+         * Both matrices must outlive their use by this filter.
+         *
+         * @param F_matrix state-transition model
+         * @param Q_matrix covariance of the process noise
+         */
+        kalman_filter_core_t &use_model(const numeric_matrix<N_, N_> &F_matrix, const numeric_matrix<N_, N_> &Q_matrix) {
+            static_assert(Model::is_linear && !Noise::is_mutable, "use_model() needs a linear model and bound noise.");
+            Model::bind_transition(F_matrix);
+            Noise::bind_process_noise(Q_matrix);
+            return *this;
+        }
+
+        /**
+         * Kalman filter update in the form selected by UpdateForm.\n
+         * With selectable_update_t, uses sequential scalar updates when R is diagonal, see set_sequential().
+         *
+         * @param z Measurement vector
+         */
+        kalman_filter_core_t &update(const numeric_vector<M_> &z) {
+            if constexpr (UpdateForm::selectable) return UpdateForm::is_sequential() ? update_sequential(z) : update_standard(z);
+            else if constexpr (UpdateForm::sequential) return update_sequential(z);
+            else return update_standard(z);
+        }
+
+        /**
+         * Kalman filter update with the full M x M innovation covariance.\n
+         * The gain is solved through the Cholesky factor of S, reusing the factor already
+         * computed by innovation_factor() or mahalanobis() since the last prediction.
+         * The covariance takes the Joseph form with joseph_update_t, and Q and R are adapted afterwards.
+         *
+         * @param z Measurement vector
+         */
+        kalman_filter_core_t &update_standard(const numeric_vector<M_> &z) {
+            const numeric_matrix<M_, M_> &L_S = innovation_factor();
+            return update_factored(z - z_pred_, L_S, Model::observation_jacobian(), P_H_t_);
+        }
+
+        /**
+         * Cholesky factor of the innovation covariance S = H P H^T + R at the current prior.\n
+         * Computed at most once between a prediction and the next update, then shared by
+         * gating and by update_standard().
+         *
+         * @return Lower-triangular factor of S
+         */
+        const numeric_matrix<M_, M_> &innovation_factor() {
+            if (!factored_) {
+                z_pred_                           = vt::move(Model::observe(x_));
+                const numeric_matrix<M_, N_> &H_k = Model::observation_jacobian();
+                P_H_t_                            = vt::move(P_.matmul_T(H_k));
+                L_S_                              = vt::move((H_k * P_H_t_ + Noise::measurement_noise()).cholesky());
+                factored_                         = true;
+            }
+            return L_S_;
+        }
+
+        /**
+         * Predicted measurement h(x) at the current prior, cached together with innovation_factor()
+         *
+         * @return Predicted measurement
+         */
+        const numeric_vector<M_> &predicted_measurement() {
+            innovation_factor();
+            return z_pred_;
+        }
+
+        /**
+         * Squared Mahalanobis distance y^T S^-1 y of a measurement from the prediction,
+         * O(M^2) per measurement once S is factored
+         *
+         * @param z Measurement vector
+         * @return Squared Mahalanobis distance
+         */
+        real_t mahalanobis(const numeric_vector<M_> &z) {
+            const numeric_vector<M_> w_ = vt::move(innovation_factor().solve_lower(z - z_pred_));
+            return w_.dot(w_);
+        }
+
+        /**
+         * Kalman filter update as M scalar updates, O(M N^2) and no matrix inverse.\n
+         * A nonlinear model is linearized once at the prior.
+         * Only valid when R is diagonal, off-diagonal entries of R are ignored.
+         *
+         * @param z Measurement vector
+         */
+        kalman_filter_core_t &update_sequential(const numeric_vector<M_> &z) {
+            const numeric_matrix<M_, M_> &R_k = Noise::measurement_noise();
+            if constexpr (Diagnostics::enabled) {
+                // S of the prior, NIS as the sum of the decorrelated scalar terms y_j^2 / s_j
+                const numeric_matrix<M_, M_> &L_S = innovation_factor();
+                const numeric_matrix<M_, N_> &H_k = Model::observation_jacobian();
+                const auto &z_lin_                = Model::linearized_measurement(z, x_, z_pred_);
+                const numeric_vector<M_> y_       = vt::move(z - z_pred_);
+                real_t nis_                       = 0;
+                for (size_t j = 0; j < M_; ++j) {
+                    const numeric_vector<N_> &h_ = H_k[j];
+                    const real_t y_j             = z_lin_[j] - h_.dot(x_);
+                    nis_ += y_j * y_j / (h_.dot(P_ * h_) + R_k[j][j]);
+                    detail::scalar_update(x_, P_, h_, y_j, R_k[j][j]);
+                }
+                Diagnostics::record(y_, L_S, nis_);
+            } else {
+                const auto &z_lin_               = Model::linearized_measurement(z, x_);
+                const numeric_matrix<M_, N_> &H_k = Model::observation_jacobian();
+                for (size_t j = 0; j < M_; ++j) {
+                    const numeric_vector<N_> &h_ = H_k[j];
+                    detail::scalar_update(x_, P_, h_, z_lin_[j] - h_.dot(x_), R_k[j][j]);
+                }
+            }
+            factored_ = false;
+            return *this;
+        }
+
+        /**
+         * Kalman filter update with only the measurement rows flagged in mask.\n
+         * Active rows of H, R and z are compacted into bounded storage, so the cost scales with
+         * the number of valid measurements K: O(K N^2 + K^3) instead of the full M x M path.
+         * The covariance takes the Joseph form with joseph_update_t. Adaptation and diagnostics work on the
+         * full innovation and are not available.
+         *
+         * @param z Measurement vector, inactive entries are ignored
+         * @param mask Whether each measurement row is valid
+         */
+        kalman_filter_core_t &update(const numeric_vector<M_> &z, const bool (&mask)[M_]) {
+            static_assert(!Adaptation::enabled, "update(z, mask) cannot adapt Q and R from a partial innovation.");
+            static_assert(!Diagnostics::enabled, "update(z, mask) cannot record diagnostics of a partial innovation.");
+            size_t rows_[M_];
+            size_t count_ = 0;
+            for (size_t j = 0; j < M_; ++j)
+                if (mask[j]) rows_[count_++] = j;
+            if (count_ == 0) return *this;
+            factored_ = false;
+
+            const auto &z_lin_               = Model::linearized_measurement(z, x_);
+            const numeric_matrix<M_, N_> &H_k = Model::observation_jacobian();
+            const numeric_matrix<M_, M_> &R_k = Noise::measurement_noise();
+
+            if (UpdateForm::is_sequential()) {
+                for (size_t i = 0; i < count_; ++i) {
+                    const numeric_vector<N_> &h_ = H_k[rows_[i]];
+                    detail::scalar_update(x_, P_, h_, z_lin_[rows_[i]] - h_.dot(x_), R_k[rows_[i]][rows_[i]]);
+                }
+                return *this;
+            }
+
+            const numeric_matrix_bounded<M_, N_> H_a(H_k, rows_, count_);
+            const numeric_matrix_bounded<M_, M_> R_a   = numeric_matrix_bounded<M_, M_>::principal(R_k, rows_, count_);
+            const numeric_matrix_bounded<N_, N_> P_a(P_);
+            const numeric_matrix_bounded<N_, M_> P_H_t = vt::move(P_a.matmul_T(H_a));
+            const numeric_matrix_bounded<M_, N_> K_t   = vt::move((H_a * P_H_t + R_a).cholesky().cholesky_solve(P_H_t.transpose()));
+
+            numeric_vector_bounded<M_> y_(count_);
+            for (size_t i = 0; i < count_; ++i) y_[i] = z_lin_[rows_[i]] - H_k[rows_[i]].dot(x_);
+
+            for (size_t n = 0; n < N_; ++n)
+                for (size_t i = 0; i < count_; ++i) x_[n] += K_t[i][n] * y_[i];
+
+            if constexpr (UpdateForm::joseph) {
+                const numeric_matrix_bounded<N_, M_> K_ = vt::move(K_t.transpose());
+                numeric_matrix_bounded<N_, N_> A_(numeric_matrix<N_, N_>::identity());
+                A_ -= K_ * H_a;
+                const numeric_matrix_bounded<N_, N_> P_next = vt::move(A_ * P_a.matmul_T(A_) + K_ * (R_a * K_t));
+                for (size_t a = 0; a < N_; ++a)
+                    for (size_t b = 0; b < N_; ++b) P_[a][b] = P_next[a][b];
+            } else {
+                for (size_t a = 0; a < N_; ++a)
+                    for (size_t i = 0; i < count_; ++i) {
+                        const real_t p_ai = P_H_t[a][i];
+                        for (size_t b = 0; b < N_; ++b) P_[a][b] -= p_ai * K_t[i][b];
+                    }
+            }
+
+            return *this;
+        }
+
+        /**
+         * Iterated extended Kalman filter update (Gauss-Newton on the MAP cost).\n
+         * Relinearizes h around the current iterate
+         * x_i+1 = x_prior + K_i (z - h(x_i) - H_i (x_prior - x_i)) until the step norm falls
+         * below tolerance or max_iterations is reached. The state and covariance are then updated once with
+         * the last linearization, in the same form as update_standard(), including diagnostics and adaptation.
+         *
+         * @param z Measurement vector
+         * @param max_iterations Iteration cap
+         * @param tolerance Threshold on the norm of the state step
+         */
+        kalman_filter_core_t &update_iterated(const numeric_vector<M_> &z,
+                                              size_t max_iterations   = 10,
+                                              const real_t &tolerance = 1e-9) {
+            static_assert(!Model::is_linear, "update_iterated() needs an extended model.");
+            numeric_vector<N_> x_i = x_;
+            numeric_vector<M_> r_;         // innovation of the prior under the last linearization
+            numeric_matrix<N_, M_> P_H_t;  // P H_i^T of the last iterate
+            numeric_matrix<M_, M_> L_S;    // Cholesky factor of S_i = H_i P H_i^T + R
+
+            for (Model::iterations_ = 1;; ++Model::iterations_) {
+                const numeric_vector<M_> h_i      = vt::move(Model::observe(x_i));
+                const numeric_matrix<M_, N_> &H_i = Model::observation_jacobian();
+
+                P_H_t                            = vt::move(P_.matmul_T(H_i));
+                L_S                              = vt::move((H_i * P_H_t + Noise::measurement_noise()).cholesky());
+                r_                               = vt::move(z - h_i - H_i * (x_ - x_i));
+                const numeric_matrix<M_, N_> K_t = vt::move(detail::cholesky_gain(P_H_t, L_S));
+
+                const numeric_vector<N_> x_next_ = vt::move(x_ + K_t.transpose() * r_);
+                const real_t step_               = (x_next_ - x_i).norm();
+                x_i                              = x_next_;
+                if (step_ <= tolerance || Model::iterations_ >= max_iterations) break;
+            }
+
+            return update_factored(r_, L_S, Model::observation_jacobian(), P_H_t);
+        }
+
+        /**
+         * Selects sequential scalar updates (or the standard update) for update().\n
+         * Defaults to sequential when R is diagonal at construction.
+         *
+         * @param sequential
+         */
+        kalman_filter_core_t &set_sequential(bool sequential) {
+            static_assert(UpdateForm::selectable, "set_sequential() needs selectable_update_t.");
+            UpdateForm::sequential_ = sequential;
+            return *this;
+        }
+
+        kalman_filter_core_t &operator<<(const numeric_vector<M_> &z) {
+            return predict().update(z);
+        }
+
+        template<typename... Ts>
+        kalman_filter_core_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+        /**
+         * State covariance
+         *
+         * @return State covariance
+         */
+        const numeric_matrix<N_, N_> &covariance() const { return P_; }
+
+        /**
+         * Innovation diagnostics recorded by the updates
+         *
+         * @return Diagnostics policy
+         */
+        const Diagnostics &diagnostics() const { return *this; }
+
+        const numeric_vector<N_> &state_vector = x_;
+
+        const real_t &state = x_[0];
+
     private:
-        // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
-        static constexpr size_t N_ = StateVectorDimension;        // ALias
-        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
-        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+        /**
+         * Common tail of the full updates, with the gain solved through the Cholesky factor of S:
+         * records diagnostics, updates x and P in the form of UpdateForm, then adapts Q and R.
+         *
+         * @param y Innovation
+         * @param L_S Cholesky factor of the innovation covariance
+         * @param H_k Measurement model or Jacobian
+         * @param P_H_t P H^T at the prior
+         */
+        kalman_filter_core_t &update_factored(const numeric_vector<M_> &y, const numeric_matrix<M_, M_> &L_S,
+                                              const numeric_matrix<M_, N_> &H_k, const numeric_matrix<N_, M_> &P_H_t) {
+            if constexpr (Diagnostics::enabled) {
+                const numeric_vector<M_> w_ = vt::move(L_S.solve_lower(y));
+                Diagnostics::record(y, L_S, w_.dot(w_));
+            }
+
+            numeric_matrix<M_, N_> K_t;
+            if constexpr (UpdateForm::joseph) {
+                K_t                             = vt::move(detail::cholesky_gain(P_H_t, L_S));
+                const numeric_matrix<N_, M_> K_ = vt::move(K_t.transpose());
+                const numeric_matrix<N_, N_> A_ = vt::move(numeric_matrix<N_, N_>::identity() - K_ * H_k);
+                x_ += K_ * y;
+                P_ = vt::move(A_ * P_.matmul_T(A_) + K_ * (Noise::measurement_noise() * K_t));
+            } else {
+                K_t = vt::move(detail::cholesky_update(x_, P_, P_H_t, L_S, y));
+            }
+
+            if constexpr (Adaptation::enabled)
+                Adaptation::adapt(y, L_S, H_k, P_, K_t, Noise::process_noise_storage(), Noise::measurement_noise_storage());
+            factored_ = false;
+
+            return *this;
+        }
+    };
+
+    /**
+     * Discrete-time linear Kalman filter
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Diagnostics Innovation diagnostics policy, e.g. innovation_monitor_t, none by default
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename Diagnostics = detail::no_diagnostics_t>
+    using kalman_filter_t =
+            kalman_filter_core_t<policy::linear_model_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension>,
+                                 policy::bound_noise_t<StateVectorDimension, MeasurementVectorDimension>,
+                                 policy::no_adaptation_t, policy::selectable_update_t, Diagnostics>;
+
+    /**
+     * Discrete-time linear Kalman filter whose state transition is an operator applied in place, e.g. vdt
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Transition State-transition operator
+     * @tparam Diagnostics Innovation diagnostics policy, none by default
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename Transition, typename Diagnostics = detail::no_diagnostics_t>
+    using structured_kalman_filter_t =
+            kalman_filter_core_t<policy::structured_model_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension,
+                                                            Transition>,
+                                 policy::bound_noise_t<StateVectorDimension, MeasurementVectorDimension>,
+                                 policy::no_adaptation_t, policy::selectable_update_t, Diagnostics>;
+
+    /**
+     * Linear Kalman filter adapting the caller's Q and R by exponential moving averages
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Diagnostics Innovation diagnostics policy, none by default
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename Diagnostics = detail::no_diagnostics_t>
+    using adaptive_kalman_filter_t =
+            kalman_filter_core_t<policy::linear_model_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension>,
+                                 policy::shared_noise_t<StateVectorDimension, MeasurementVectorDimension>,
+                                 policy::ema_adaptation_t, policy::standard_update_t, Diagnostics>;
+
+    /**
+     * Discrete-time extended Kalman filter
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam StateFunc State-transition model
+     * @tparam StateJacobian State-transition Jacobian or combined evaluator
+     * @tparam ObservationFunc Measurement model
+     * @tparam ObservationJacobian Measurement Jacobian or combined evaluator
+     * @tparam Diagnostics Innovation diagnostics policy, e.g. innovation_monitor_t, none by default
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename StateFunc           = detail::state_func_t<StateVectorDimension, ControlVectorDimension>,
+             typename StateJacobian       = detail::state_jacobian_t<StateVectorDimension, ControlVectorDimension>,
+             typename ObservationFunc     = detail::observation_func_t<StateVectorDimension, MeasurementVectorDimension>,
+             typename ObservationJacobian = detail::observation_jacobian_t<StateVectorDimension, MeasurementVectorDimension>,
+             typename Diagnostics         = detail::no_diagnostics_t>
+    using extended_kalman_filter_t =
+            kalman_filter_core_t<policy::extended_model_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension,
+                                                          StateFunc, StateJacobian, ObservationFunc, ObservationJacobian>,
+                                 policy::bound_noise_t<StateVectorDimension, MeasurementVectorDimension>,
+                                 policy::no_adaptation_t, policy::selectable_update_t, Diagnostics>;
+
+    /**
+     * Extended Kalman filter adapting the caller's Q and R by exponential moving averages
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam StateFunc State-transition model
+     * @tparam StateJacobian State-transition Jacobian or combined evaluator
+     * @tparam ObservationFunc Measurement model
+     * @tparam ObservationJacobian Measurement Jacobian or combined evaluator
+     * @tparam Diagnostics Innovation diagnostics policy, none by default
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename StateFunc           = detail::state_func_t<StateVectorDimension, ControlVectorDimension>,
+             typename StateJacobian       = detail::state_jacobian_t<StateVectorDimension, ControlVectorDimension>,
+             typename ObservationFunc     = detail::observation_func_t<StateVectorDimension, MeasurementVectorDimension>,
+             typename ObservationJacobian = detail::observation_jacobian_t<StateVectorDimension, MeasurementVectorDimension>,
+             typename Diagnostics         = detail::no_diagnostics_t>
+    using adaptive_extended_kalman_filter_t =
+            kalman_filter_core_t<policy::extended_model_t<StateVectorDimension, MeasurementVectorDimension, ControlVectorDimension,
+                                                          StateFunc, StateJacobian, ObservationFunc, ObservationJacobian>,
+                                 policy::shared_noise_t<StateVectorDimension, MeasurementVectorDimension>,
+                                 policy::ema_adaptation_t, policy::standard_update_t, Diagnostics>;
+
+    /**
+     * Creates extended Kalman filter deducing the callable types of the models and Jacobians.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam Diagnostics Innovation diagnostics policy
+     * @param f_vec_func state-transition model
+     * @param Fj_mat_func state-transition Jacobian
+     * @param h_vec_func measurement model
+     * @param Hj_mat_func measurement Jacobian
+     * @param Q_matrix covariance of the process noise
+     * @param R_matrix covariance of the measurement noise
+     * @param x_0 initial state vector
+     * @return Extended Kalman filter
+     */
+    template<size_t N, size_t M, size_t L, typename Diagnostics = detail::no_diagnostics_t,
+             typename StateFunc, typename StateJacobian, typename ObservationFunc, typename ObservationJacobian>
+    extended_kalman_filter_t<N, M, L, StateFunc, StateJacobian, ObservationFunc, ObservationJacobian, Diagnostics>
+    make_extended_kalman_filter(StateFunc f_vec_func, StateJacobian Fj_mat_func,
+                                ObservationFunc h_vec_func, ObservationJacobian Hj_mat_func,
+                                const numeric_matrix<N, N> &Q_matrix, const numeric_matrix<M, M> &R_matrix,
+                                const numeric_vector<N> &x_0) {
+        return {f_vec_func, Fj_mat_func, h_vec_func, Hj_mat_func, Q_matrix, R_matrix, x_0};
+    }
+
+    /**
+     * Creates extended Kalman filter from combined evaluators returning linearization_t.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam Diagnostics Innovation diagnostics policy
+     * @param f_lin_func state-transition model and Jacobian
+     * @param h_lin_func measurement model and Jacobian
+     * @param Q_matrix covariance of the process noise
+     * @param R_matrix covariance of the measurement noise
+     * @param x_0 initial state vector
+     * @return Extended Kalman filter
+     */
+    template<size_t N, size_t M, size_t L, typename Diagnostics = detail::no_diagnostics_t,
+             typename StateLinearization, typename ObservationLinearization>
+    extended_kalman_filter_t<N, M, L, detail::no_func_t, StateLinearization, detail::no_func_t, ObservationLinearization, Diagnostics>
+    make_extended_kalman_filter(StateLinearization f_lin_func, ObservationLinearization h_lin_func,
+                                const numeric_matrix<N, N> &Q_matrix, const numeric_matrix<M, M> &R_matrix,
+                                const numeric_vector<N> &x_0) {
+        return {f_lin_func, h_lin_func, Q_matrix, R_matrix, x_0};
+    }
+
+    /**
+     * Creates extended Kalman filter whose Jacobians come from automatic differentiation of f and h.\n
+     * f and h must be generic over the scalar type, e.g. lambdas taking const auto &x, and return
+     * vectors of the same scalar type as x. Each predict and update evaluates its model once.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam Diagnostics Innovation diagnostics policy
+     * @param f_vec_func state-transition model f(x, u)
+     * @param h_vec_func measurement model h(x)
+     * @param Q_matrix covariance of the process noise
+     * @param R_matrix covariance of the measurement noise
+     * @param x_0 initial state vector
+     * @return Extended Kalman filter
+     */
+    template<size_t N, size_t M, size_t L, typename Diagnostics = detail::no_diagnostics_t,
+             typename StateFunc, typename ObservationFunc>
+    extended_kalman_filter_t<N, M, L, detail::no_func_t, detail::autodiff_state_t<N, L, StateFunc>,
+                             detail::no_func_t, detail::autodiff_observation_t<N, M, ObservationFunc>, Diagnostics>
+    make_autodiff_extended_kalman_filter(StateFunc f_vec_func, ObservationFunc h_vec_func,
+                                         const numeric_matrix<N, N> &Q_matrix, const numeric_matrix<M, M> &R_matrix,
+                                         const numeric_vector<N> &x_0) {
+        return {detail::autodiff_state_t<N, L, StateFunc>{f_vec_func},
+                detail::autodiff_observation_t<N, M, ObservationFunc>{h_vec_func},
+                Q_matrix, R_matrix, x_0};
+    }
+
+    /**
+     * Kalman filter for Axes decoupled, identical axes with interleaved state {s0_x, s0_y, ..., s1_x, s1_y, ...},
+     * i.e. F = F1 (x) I, H = H1 (x) I, Q = Q1 (x) I and R = R1 (x) I.\n
+     * All axes share one covariance and gain, which evolve independently of the measurements.
+     * States are stored component-major so each row holds one component across all axes
+     * and every state operation runs over contiguous lanes.
+     *
+     * @tparam Axes Number of decoupled axes
+     * @tparam AxisStateDimension State vector dimension of one axis
+     * @tparam AxisMeasurementDimension Measurement vector dimension of one axis
+     * @tparam AxisControlDimension Control vector dimension of one axis
+     */
+    template<size_t Axes, size_t AxisStateDimension, size_t AxisMeasurementDimension, size_t AxisControlDimension>
+    class separable_kalman_filter_t {
+    private:
+        static constexpr size_t A_ = Axes;                      // Alias
+        static constexpr size_t N_ = AxisStateDimension;        // Alias
+        static constexpr size_t M_ = AxisMeasurementDimension;  // Alias
+        static constexpr size_t L_ = AxisControlDimension;      // Alias
 
     protected:
-        numeric_matrix<N_, N_> &F_;        // state-transition model
-        const numeric_matrix<N_, L_> &B_;  // control-input model
-        const numeric_matrix<M_, N_> &H_;  // measurement model
-        const numeric_matrix<N_, N_> &Q_;  // covariance of the process noise
-        const numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
-        numeric_vector<N_> x_;             // state vector
-        numeric_matrix<N_, N_> P_;         // state covariance, self-initialized as Q_
+        const numeric_matrix<N_, N_> &F_;  // per-axis state-transition model
+        const numeric_matrix<N_, L_> &B_;  // per-axis control-input model
+        const numeric_matrix<M_, N_> &H_;  // per-axis measurement model
+        const numeric_matrix<N_, N_> &Q_;  // per-axis covariance of the process noise
+        const numeric_matrix<M_, M_> &R_;  // per-axis covariance of the measurement noise
+        numeric_matrix<N_, A_> X_;         // state lanes, column a is axis a
+        numeric_matrix<N_, N_> P_;         // shared per-axis state covariance, self-initialized as Q_
 
     public:
         /**
-         * Simple Kalman filter array-copying constructor
+         * Separable Kalman filter constructor
          *
-         * @param F_matrix state-transition model
-         * @param B_matrix control-input model
-         * @param H_matrix measurement model
-         * @param Q_matrix covariance of the process noise
-         * @param R_matrix covariance of the measurement noise
-         * @param x_0 initial state vector
+         * @param F_matrix per-axis state-transition model
+         * @param B_matrix per-axis control-input model
+         * @param H_matrix per-axis measurement model
+         * @param Q_matrix per-axis covariance of the process noise
+         * @param R_matrix per-axis covariance of the measurement noise
+         * @param x_0 initial interleaved state vector
          */
-        constexpr kalman_filter_t(
-                numeric_matrix<N_, N_> &F_matrix,
+        separable_kalman_filter_t(
+                const numeric_matrix<N_, N_> &F_matrix,
                 const numeric_matrix<N_, L_> &B_matrix,
                 const numeric_matrix<M_, N_> &H_matrix,
                 const numeric_matrix<N_, N_> &Q_matrix,
                 const numeric_matrix<M_, M_> &R_matrix,
-                const numeric_vector<N_> &x_0,
-                const real_t & = 0.,
-                const real_t & = 0.)
+                const numeric_vector<N_ * A_> &x_0)
             : F_{F_matrix}, B_{B_matrix}, H_{H_matrix},
-              Q_{Q_matrix}, R_{R_matrix}, x_{x_0}, P_{Q_matrix} {}
-
-        constexpr kalman_filter_t(const kalman_filter_t &) = default;
-
-        constexpr kalman_filter_t(kalman_filter_t &&) noexcept = default;
+              Q_{Q_matrix}, R_{R_matrix}, P_{Q_matrix} {
+            for (size_t i = 0; i < N_; ++i)
+                for (size_t a = 0; a < A_; ++a) X_[i][a] = x_0[i * A_ + a];
+        }
 
-        kalman_filter_t &operator=(const kalman_filter_t &) = default;
+        separable_kalman_filter_t(const separable_kalman_filter_t &) = default;
 
-        kalman_filter_t &operator=(kalman_filter_t &&) noexcept = default;
+        separable_kalman_filter_t(separable_kalman_filter_t &&) noexcept = default;
 
         /**
          * Kalman filter prediction
          *
-         * @param u control input vector
+         * @param u interleaved control input vector
          */
-        kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
-            x_ = vt::move(F_ * x_ + B_ * u);
-            P_ = vt::move(F_ * P_.matmul_T(F_) + Q_);
+        separable_kalman_filter_t &predict(const numeric_vector<L_ * A_> &u = {}) {
+            numeric_matrix<N_, A_> X_next;
+            for (size_t i = 0; i < N_; ++i) {
+                for (size_t k = 0; k < N_; ++k) {
+                    const real_t fik = F_[i][k];
+                    for (size_t a = 0; a < A_; ++a) X_next[i][a] += fik * X_[k][a];
+                }
+                for (size_t k = 0; k < L_; ++k) {
+                    const real_t bik = B_[i][k];
+                    for (size_t a = 0; a < A_; ++a) X_next[i][a] += bik * u[k * A_ + a];
+                }
+            }
+            X_ = vt::move(X_next);
+            P_ = vt::move(detail::covariance_predict(F_, P_, Q_));
             return *this;
         }
 
         /**
          * Kalman filter update
          *
-         * @param z Measurement vector
+         * @param z interleaved measurement vector
          */
-        kalman_filter_t &update(const numeric_vector<M_> &z) {
-            numeric_vector<M_> y_        = vt::move(z - H_ * x_);
-            numeric_matrix<N_, M_> P_H_t = vt::move(P_.matmul_T(H_));
-            numeric_matrix<M_, M_> S_    = vt::move(H_ * P_H_t + R_);
-            numeric_matrix<N_, M_> K_    = vt::move(P_H_t * S_.inverse());
-
-            x_ += K_ * y_;
-            P_ = vt::move((numeric_matrix<N_, N_>::identity() - K_ * H_) * P_);
+        separable_kalman_filter_t &update(const numeric_vector<M_ * A_> &z) {
+            // K^T = S^-1 H P, solved once through the Cholesky factor of S and shared by all axes
+            const numeric_matrix<N_, M_> P_H_t = vt::move(P_.matmul_T(H_));
+            const numeric_matrix<M_, M_> L_S   = vt::move((H_ * P_H_t + R_).cholesky());
+            const numeric_matrix<M_, N_> K_t   = vt::move(detail::cholesky_gain(P_H_t, L_S));
+
+            numeric_matrix<M_, A_> Y_;
+            for (size_t j = 0; j < M_; ++j) {
+                for (size_t a = 0; a < A_; ++a) Y_[j][a] = z[j * A_ + a];
+                for (size_t k = 0; k < N_; ++k) {
+                    const real_t hjk = H_[j][k];
+                    for (size_t a = 0; a < A_; ++a) Y_[j][a] -= hjk * X_[k][a];
+                }
+            }
+            for (size_t i = 0; i < N_; ++i)
+                for (size_t j = 0; j < M_; ++j) {
+                    const real_t kij = K_t[j][i];
+                    for (size_t a = 0; a < A_; ++a) X_[i][a] += kij * Y_[j][a];
+                }
 
+            P_ -= P_H_t * K_t;
             return *this;
         }
 
-        kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+        separable_kalman_filter_t &operator<<(const numeric_vector<M_ * A_> &z) {
             return predict().update(z);
         }
 
         template<typename... Ts>
-        kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+        separable_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
 
-        const numeric_vector<N_> &state_vector = x_;
+        /**
+         * Combined interleaved state vector
+         *
+         * @return State vector of all axes
+         */
+        numeric_vector<N_ * A_> state_vector() const {
+            numeric_vector<N_ * A_> x;
+            for (size_t i = 0; i < N_; ++i)
+                for (size_t a = 0; a < A_; ++a) x[i * A_ + a] = X_[i][a];
+            return x;
+        }
 
-        const real_t &state = x_[0];
+        /**
+         * State vector of one axis
+         *
+         * @param axis Axis index
+         * @return Per-axis state vector
+         */
+        numeric_vector<N_> axis_state(size_t axis) const { return X_.col(axis); }
+
+        /**
+         * Per-axis state covariance, shared by all axes
+         *
+         * @return Per-axis state covariance
+         */
+        const numeric_matrix<N_, N_> &axis_covariance() const { return P_; }
+
+        /**
+         * Combined state covariance P1 (x) I in factored form
+         *
+         * @return Combined state covariance
+         */
+        impl::numeric_matrix_kron_t<real_t, N_, N_, A_, A_> covariance() const {
+            return make_kron(P_, numeric_matrix<A_, A_>::identity());
+        }
     };
 
-    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
-    class adaptive_kalman_filter_t {
+    /**
+     * Square-root Kalman filter propagating lower-triangular S with P = S * S^T.\n
+     * Prediction triangularizes [F S, sqrt(Q)], update triangularizes
+     * [[sqrt(R), H S], [0, S]] into [[sqrt(S_y), 0], [K sqrt(S_y), S+]].
+     * P stays symmetric positive semi-definite by construction, so single precision is usable.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam T data type
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+             typename T = real_t>
+    class sqrt_kalman_filter_t {
     private:
-        // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
         static constexpr size_t N_ = StateVectorDimension;        // ALias
         static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
         static constexpr size_t L_ = ControlVectorDimension;      // Alias
 
     protected:
-        numeric_matrix<N_, N_> &F_;        // state-transition model
-        const numeric_matrix<N_, L_> &B_;  // control-input model
-        const numeric_matrix<M_, N_> &H_;  // measurement model
-        numeric_matrix<N_, N_> &Q_;        // covariance of the process noise
-        numeric_matrix<M_, M_> &R_;        // covariance of the measurement noise
-        numeric_vector<N_> x_;             // state vector
-        numeric_matrix<N_, N_> P_;         // state covariance, self-initialized as Q_
-        const real_t alpha_;               // EMA Smoothing factor for R
-        const real_t beta_;                // EMA Smoothing factor for Q
+        const generic_matrix<T, N_, N_> &F_;  // state-transition model
+        const generic_matrix<T, N_, L_> &B_;  // control-input model
+        const generic_matrix<T, M_, N_> &H_;  // measurement model
+        generic_matrix<T, N_, N_> sqrt_Q_;    // Cholesky factor of the process noise covariance
+        generic_matrix<T, M_, M_> sqrt_R_;    // Cholesky factor of the measurement noise covariance
+        generic_vector<T, N_> x_;             // state vector
+        generic_matrix<T, N_, N_> S_;         // Cholesky factor of the state covariance, self-initialized as sqrt(Q)
 
     public:
         /**
-         * Simple Kalman filter array-copying constructor
+         * Square-root Kalman filter constructor
          *
          * @param F_matrix state-transition model
          * @param B_matrix control-input model
@@ -134,38 +1543,38 @@ namespace vt {
          * @param Q_matrix covariance of the process noise
          * @param R_matrix covariance of the measurement noise
          * @param x_0 initial state vector
-         * @param alpha EMA Smoothing factor for R
-         * @param beta EMA Smoothing factor for Q
          */
-        constexpr adaptive_kalman_filter_t(
-                numeric_matrix<N_, N_> &F_matrix,
-                const numeric_matrix<N_, L_> &B_matrix,
-                const numeric_matrix<M_, N_> &H_matrix,
-                numeric_matrix<N_, N_> &Q_matrix,
-                numeric_matrix<M_, M_> &R_matrix,
-                const numeric_vector<N_> &x_0,
-                const real_t &alpha = 0.1,
-                const real_t &beta  = 0.1)
+        sqrt_kalman_filter_t(
+                const generic_matrix<T, N_, N_> &F_matrix,
+                const generic_matrix<T, N_, L_> &B_matrix,
+                const generic_matrix<T, M_, N_> &H_matrix,
+                const generic_matrix<T, N_, N_> &Q_matrix,
+                const generic_matrix<T, M_, M_> &R_matrix,
+                const generic_vector<T, N_> &x_0)
             : F_{F_matrix}, B_{B_matrix}, H_{H_matrix},
-              Q_{Q_matrix}, R_{R_matrix}, x_{x_0}, P_{Q_matrix},
-              alpha_{alpha}, beta_{beta} {}
-
-        constexpr adaptive_kalman_filter_t(const adaptive_kalman_filter_t &) = default;
+              sqrt_Q_{Q_matrix.cholesky()}, sqrt_R_{R_matrix.cholesky()},
+              x_{x_0}, S_{sqrt_Q_} {}
 
-        constexpr adaptive_kalman_filter_t(adaptive_kalman_filter_t &&) noexcept = default;
+        sqrt_kalman_filter_t(const sqrt_kalman_filter_t &) = default;
 
-        adaptive_kalman_filter_t &operator=(const adaptive_kalman_filter_t &) = default;
-
-        adaptive_kalman_filter_t &operator=(adaptive_kalman_filter_t &&) noexcept = default;
+        sqrt_kalman_filter_t(sqrt_kalman_filter_t &&) noexcept = default;
 
         /**
          * Kalman filter prediction
          *
          * @param u control input vector
          */
-        adaptive_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
+        sqrt_kalman_filter_t &predict(const generic_vector<T, L_> &u = {}) {
             x_ = vt::move(F_ * x_ + B_ * u);
-            P_ = vt::move(F_ * P_.matmul_T(F_) + Q_);
+
+            generic_matrix<T, N_, 2 * N_> pre_;
+            const generic_matrix<T, N_, N_> FS_ = vt::move(F_ * S_);
+            for (size_t i = 0; i < N_; ++i)
+                for (size_t j = 0; j < N_; ++j) {
+                    pre_[i][j]      = FS_[i][j];
+                    pre_[i][N_ + j] = sqrt_Q_[i][j];
+                }
+            S_ = vt::move(pre_.tria());
             return *this;
         }
 
@@ -174,221 +1583,407 @@ namespace vt {
          *
          * @param z Measurement vector
          */
-        adaptive_kalman_filter_t &update(const numeric_vector<M_> &z) {
-            numeric_vector<M_> y_        = vt::move(z - H_ * x_);
-            numeric_matrix<N_, M_> P_H_t = vt::move(P_.matmul_T(H_));
-            numeric_matrix<M_, M_> S_    = vt::move(H_ * P_H_t + R_);
-            numeric_matrix<N_, M_> K_    = vt::move(P_H_t * S_.inverse());
-
-            x_ += K_ * y_;
-            P_ = vt::move((numeric_matrix<N_, N_>::identity() - K_ * H_) * P_);
-
-            numeric_matrix<M_, 1> y_mat = y_.as_matrix_col();
-            numeric_matrix<M_, M_> y_yT = y_mat.matmul_T(y_mat);
-
-            adapt_R(y_yT, S_);
-            adapt_Q(K_, y_yT);
-
+        sqrt_kalman_filter_t &update(const generic_vector<T, M_> &z) {
+            generic_matrix<T, M_ + N_, M_ + N_> pre_;
+            const generic_matrix<T, M_, N_> HS_ = vt::move(H_ * S_);
+            for (size_t i = 0; i < M_; ++i) {
+                for (size_t j = 0; j < M_; ++j) pre_[i][j] = sqrt_R_[i][j];
+                for (size_t j = 0; j < N_; ++j) pre_[i][M_ + j] = HS_[i][j];
+            }
+            for (size_t i = 0; i < N_; ++i)
+                for (size_t j = 0; j < N_; ++j) pre_[M_ + i][M_ + j] = S_[i][j];
+
+            const generic_matrix<T, M_ + N_, M_ + N_> post_ = vt::move(pre_.tria());
+
+            // Innovation in the whitened frame: sqrt(S_y)^-1 (z - H x)
+            generic_matrix<T, M_, M_> sqrt_Sy_;
+            for (size_t i = 0; i < M_; ++i)
+                for (size_t j = 0; j <= i; ++j) sqrt_Sy_[i][j] = post_[i][j];
+            const generic_vector<T, M_> e_ = vt::move(sqrt_Sy_.solve_lower(z - H_ * x_));
+
+            for (size_t i = 0; i < N_; ++i) {
+                T dx_ = 0;
+                for (size_t j = 0; j < M_; ++j) dx_ += post_[M_ + i][j] * e_[j];
+                x_[i] += dx_;
+                for (size_t j = 0; j < N_; ++j) S_[i][j] = post_[M_ + i][M_ + j];
+            }
             return *this;
         }
 
-        adaptive_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+        sqrt_kalman_filter_t &operator<<(const generic_vector<T, M_> &z) {
             return predict().update(z);
         }
 
         template<typename... Ts>
-        adaptive_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+        sqrt_kalman_filter_t &update(Ts... vs) { return update(make_generic_vector<T>({static_cast<T>(vs)...})); }
 
-        const numeric_vector<N_> &state_vector = x_;
-        const real_t &state                    = x_[0];
-        const numeric_matrix<M_, M_> &R        = R_;
-        const numeric_matrix<N_, N_> &Q        = Q_;
+        /**
+         * State vector
+         *
+         * @return State vector
+         */
+        const generic_vector<T, N_> &state_vector() const { return x_; }
 
-    private:
-        void adapt_R(const numeric_matrix<M_, M_> &y_yT, const numeric_matrix<M_, M_> &S) {
-            R_ = (1 - alpha_) * R_ + alpha_ * (y_yT + S);
-        }
+        /**
+         * Cholesky factor S of the state covariance
+         *
+         * @return Lower-triangular S
+         */
+        const generic_matrix<T, N_, N_> &covariance_factor() const { return S_; }
 
-        void adapt_Q(const numeric_matrix<N_, M_> &K, const numeric_matrix<M_, M_> &y_yT) {
-            Q_ = (1 - beta_) * Q_ + beta_ * (K * y_yT * K.transpose());
-        }
+        /**
+         * State covariance S * S^T
+         *
+         * @return State covariance
+         */
+        generic_matrix<T, N_, N_> covariance() const { return S_.matmul_T(S_); }
     };
 
+    /**
+     * Information filter keeping Y = P^-1 and y = P^-1 x.\n
+     * Each measurement contributes additive H^T R^-1 H and H^T R^-1 z terms, so many sensors
+     * (or M larger than N) fuse without inverting an innovation covariance.
+     * Prediction uses Y- = Q^-1 - Q^-1 F C^-1 F^T Q^-1 with C = Y + F^T Q^-1 F,
+     * one N x N Cholesky factorization per cycle, and does not require F to be invertible.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension of the bound sensor
+     * @tparam ControlVectorDimension Control vector dimension
+     */
     template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
-    class extended_kalman_filter_t {
+    class information_filter_t {
     private:
-        // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
         static constexpr size_t N_ = StateVectorDimension;        // ALias
         static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
         static constexpr size_t L_ = ControlVectorDimension;      // Alias
 
-    public:
-        using state_func_t           = numeric_vector<N_> (*)(const numeric_vector<N_> &x, const numeric_vector<L_> &u);
-        using state_jacobian_t       = numeric_matrix<N_, N_> (*)(const numeric_vector<N_> &x, const numeric_vector<L_> &u);
-        using observation_func_t     = numeric_vector<M_> (*)(const numeric_vector<N_> &x);
-        using observation_jacobian_t = numeric_matrix<M_, N_> (*)(const numeric_vector<N_> &x);
-
     protected:
-        const state_func_t f_;             // state-transition model
-        const state_jacobian_t Fj_;        // state-transition Jacobian
-        const observation_func_t h_;       // measurement model
-        const observation_jacobian_t Hj_;  // measurement Jacobian
-        const numeric_matrix<N_, N_> &Q_;  // covariance of the process noise
-        const numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
-        numeric_vector<N_> x_;             // state vector
-        numeric_matrix<N_, N_> P_;         // state covariance, self-initialized as Q_
+        const numeric_matrix<N_, N_> &F_;  // state-transition model
+        const numeric_matrix<N_, L_> &B_;  // control-input model
+        numeric_matrix<N_, N_> Q_inv_;     // inverse covariance of the process noise
+        numeric_matrix<N_, M_> Ht_R_inv_;  // H^T R^-1 of the bound sensor
+        numeric_matrix<N_, N_> I_;         // H^T R^-1 H of the bound sensor
+        numeric_matrix<N_, N_> Y_;         // information matrix, self-initialized as Q^-1
+        numeric_vector<N_> y_;             // information vector
 
     public:
-        constexpr extended_kalman_filter_t(
-                const state_func_t f_vec_func,
-                const state_jacobian_t Fj_mat_func,
-                const observation_func_t h_vec_func,
-                const observation_jacobian_t Hj_mat_func,
+        /**
+         * Information filter constructor
+         *
+         * @param F_matrix state-transition model
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         */
+        information_filter_t(
+                const numeric_matrix<N_, N_> &F_matrix,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<M_, N_> &H_matrix,
                 const numeric_matrix<N_, N_> &Q_matrix,
                 const numeric_matrix<M_, M_> &R_matrix,
                 const numeric_vector<N_> &x_0)
-            : f_(f_vec_func), Fj_{Fj_mat_func}, h_{h_vec_func}, Hj_{Hj_mat_func},
-              Q_{Q_matrix}, R_{R_matrix}, x_{x_0}, P_{Q_matrix} {}
-
-        constexpr extended_kalman_filter_t(const extended_kalman_filter_t &) = default;
+            : F_{F_matrix}, B_{B_matrix}, Q_inv_{Q_matrix.solve(numeric_matrix<N_, N_>::identity())},
+              Ht_R_inv_{H_matrix.transpose() * R_matrix.solve(numeric_matrix<M_, M_>::identity())},
+              I_{Ht_R_inv_ * H_matrix}, Y_{Q_inv_}, y_{Q_inv_ * x_0} {}
 
-        constexpr extended_kalman_filter_t(extended_kalman_filter_t &&) noexcept = default;
+        information_filter_t(const information_filter_t &) = default;
 
-        extended_kalman_filter_t &operator=(const extended_kalman_filter_t &) = default;
+        information_filter_t(information_filter_t &&) noexcept = default;
 
-        extended_kalman_filter_t &operator=(extended_kalman_filter_t &&) noexcept = default;
-
-        extended_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
-            x_                        = vt::move(f_(x_, u));
-            numeric_matrix<N_, N_> F_ = vt::move(Fj_(x_, u));
-            P_                        = vt::move(F_ * P_.matmul_T(F_) + Q_);
+        /**
+         * Information filter prediction
+         *
+         * @param u control input vector
+         */
+        information_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            const numeric_matrix<N_, N_> Q_inv_F_ = vt::move(Q_inv_ * F_);
+            const numeric_matrix<N_, N_> C_       = vt::move(Y_ + F_.transpose() * Q_inv_F_);
+            const numeric_matrix<N_, N_> L_c_     = vt::move(C_.cholesky());
+
+            // Row j of W is C^-1 (Q^-1 F)^T e_j, so Q^-1 F C^-1 F^T Q^-1 = Q^-1 F W^T
+            numeric_matrix<N_, N_> W_;
+            for (size_t j = 0; j < N_; ++j) W_[j] = vt::move(L_c_.solve_lower_T(L_c_.solve_lower(Q_inv_F_[j])));
+
+            const numeric_vector<N_> Fx_ = vt::move(Q_inv_F_ * L_c_.solve_lower_T(L_c_.solve_lower(y_)));
+            Y_                           = vt::move(Q_inv_ - Q_inv_F_.matmul_T(W_));
+            y_                           = vt::move(Fx_ + Y_ * (B_ * u));
             return *this;
         }
 
-        extended_kalman_filter_t &update(const numeric_vector<M_> &z) {
-            numeric_vector<M_> y_          = vt::move(z - h_(x_));
-            numeric_matrix<M_, N_> Hjx_    = vt::move(Hj_(x_));
-            numeric_matrix<N_, M_> P_Hjx_t = vt::move(P_.matmul_T(Hjx_));
-            numeric_matrix<M_, M_> S_      = vt::move(Hjx_ * P_Hjx_t + R_);
-            numeric_matrix<N_, M_> K_      = vt::move(P_Hjx_t * S_.inverse());
+        /**
+         * Information filter update with the bound sensor
+         *
+         * @param z Measurement vector
+         */
+        information_filter_t &update(const numeric_vector<M_> &z) {
+            Y_ += I_;
+            y_ += Ht_R_inv_ * z;
+            return *this;
+        }
 
-            x_ += K_ * y_;
-            P_ = vt::move((numeric_matrix<N_, N_>::identity() - K_ * Hj_(x_)) * P_);
+        /**
+         * Information filter update with an additional sensor
+         *
+         * @tparam OM Measurement vector dimension of the sensor
+         * @param H_matrix measurement model
+         * @param R_matrix covariance of the measurement noise
+         * @param z Measurement vector
+         */
+        template<size_t OM>
+        information_filter_t &update(const numeric_matrix<OM, N_> &H_matrix,
+                                     const numeric_matrix<OM, OM> &R_matrix,
+                                     const numeric_vector<OM> &z) {
+            const numeric_matrix<N_, OM> Ht_R_inv =
+                    vt::move(H_matrix.transpose() * R_matrix.solve(numeric_matrix<OM, OM>::identity()));
+            return fuse(Ht_R_inv * H_matrix, Ht_R_inv * z);
+        }
 
+        /**
+         * Adds a precomputed information contribution H^T R^-1 H and H^T R^-1 z.\n
+         * Contributions are additive and can be accumulated independently before fusing.
+         *
+         * @param information_matrix H^T R^-1 H
+         * @param information_vector H^T R^-1 z
+         */
+        information_filter_t &fuse(const numeric_matrix<N_, N_> &information_matrix,
+                                   const numeric_vector<N_> &information_vector) {
+            Y_ += information_matrix;
+            y_ += information_vector;
             return *this;
         }
 
-        extended_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+        information_filter_t &operator<<(const numeric_vector<M_> &z) {
             return predict().update(z);
         }
 
         template<typename... Ts>
-        extended_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+        information_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
 
-        const numeric_vector<N_> &state_vector = x_;
+        /**
+         * Recovers the state vector with one Cholesky solve Y x = y
+         *
+         * @return State vector
+         */
+        numeric_vector<N_> state_vector() const {
+            const numeric_matrix<N_, N_> L_y_ = vt::move(Y_.cholesky());
+            return L_y_.solve_lower_T(L_y_.solve_lower(y_));
+        }
 
-        const real_t &state = x_[0];
+        /**
+         * Recovers the state covariance Y^-1
+         *
+         * @return State covariance
+         */
+        numeric_matrix<N_, N_> covariance() const { return Y_.solve(numeric_matrix<N_, N_>::identity()); }
+
+        const numeric_matrix<N_, N_> &information_matrix() const { return Y_; }
+
+        const numeric_vector<N_> &information_vector() const { return y_; }
     };
 
+    /**
+     * Solves the filtering discrete algebraic Riccati equation
+     * P = F P F^T - F P H^T (H P H^T + R)^-1 H P F^T + Q
+     * for the steady-state prior covariance using the structure-preserving doubling algorithm.\n
+     * Starting from A = F^T, G = H^T R^-1 H, X = Q, each doubling step
+     * W = I + G X, A' = A W^-1 A, G' = G + A W^-1 G A^T, X' = X + A^T X W^-1 A
+     * squares the horizon, so convergence is quadratic.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @param F_matrix state-transition model
+     * @param H_matrix measurement model
+     * @param Q_matrix covariance of the process noise
+     * @param R_matrix covariance of the measurement noise
+     * @param max_iterations Doubling step cap
+     * @param tolerance Relative convergence threshold on covariance entries
+     * @return Steady-state prior covariance
+     */
+    template<size_t N, size_t M>
+    numeric_matrix<N, N> dare(const numeric_matrix<N, N> &F_matrix,
+                              const numeric_matrix<M, N> &H_matrix,
+                              const numeric_matrix<N, N> &Q_matrix,
+                              const numeric_matrix<M, M> &R_matrix,
+                              size_t max_iterations   = 64,
+                              const real_t &tolerance = 1e-12) {
+        numeric_matrix<N, N> A = F_matrix.transpose();
+        numeric_matrix<N, N> G = H_matrix.transpose() * R_matrix.solve(H_matrix);
+        numeric_matrix<N, N> X = Q_matrix;
+
+        for (size_t k = 0; k < max_iterations; ++k) {
+            const numeric_matrix<N, N> W       = vt::move(numeric_matrix<N, N>::identity() + G * X);
+            const numeric_matrix<N, N> W_inv_A = vt::move(W.solve(A));
+            const numeric_matrix<N, N> W_inv_G = vt::move(W.solve(G));
+
+            numeric_matrix<N, N> X_next = vt::move(X + A.transpose() * X * W_inv_A);
+            G                           = vt::move(G + A * W_inv_G.matmul_T(A));
+            A                           = vt::move(A * W_inv_A);
+
+            real_t diff = 0, scale = 1;
+            for (size_t i = 0; i < N; ++i)
+                for (size_t j = 0; j < N; ++j) {
+                    diff  = max(diff, abs(X_next[i][j] - X[i][j]));
+                    scale = max(scale, abs(X_next[i][j]));
+                }
+            X = vt::move(X_next);
+            if (diff <= tolerance * scale) break;
+        }
+        return (X + X.transpose()) * 0.5;
+    }
+
+    /**
+     * Computes steady-state Kalman gain K = P H^T (H P H^T + R)^-1 from the DARE solution.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @param F_matrix state-transition model
+     * @param H_matrix measurement model
+     * @param Q_matrix covariance of the process noise
+     * @param R_matrix covariance of the measurement noise
+     * @return Steady-state Kalman gain
+     */
+    template<size_t N, size_t M>
+    numeric_matrix<N, M> steady_state_gain(const numeric_matrix<N, N> &F_matrix,
+                                           const numeric_matrix<M, N> &H_matrix,
+                                           const numeric_matrix<N, N> &Q_matrix,
+                                           const numeric_matrix<M, M> &R_matrix) {
+        const numeric_matrix<N, N> P   = vt::move(dare(F_matrix, H_matrix, Q_matrix, R_matrix));
+        const numeric_matrix<M, N> H_P = vt::move(H_matrix * P);
+        return (H_P.matmul_T(H_matrix) + R_matrix).solve(H_P).transpose();
+    }
+
+    /**
+     * Steady-state Kalman filter for time-invariant models.\n
+     * The gain K is solved once from the DARE at construction, and predict-update collapses to
+     * x = Phi x + Gamma u + K z with Phi = (I - K H) F and Gamma = (I - K H) B.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     */
     template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
-    class adaptive_extended_kalman_filter_t {
+    class steady_state_kalman_filter_t {
     private:
-        // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
         static constexpr size_t N_ = StateVectorDimension;        // ALias
         static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
         static constexpr size_t L_ = ControlVectorDimension;      // Alias
 
-    public:
-        using state_func_t           = numeric_vector<N_> (*)(const numeric_vector<N_> &x, const numeric_vector<L_> &u);
-        using state_jacobian_t       = numeric_matrix<N_, N_> (*)(const numeric_vector<N_> &x, const numeric_vector<L_> &u);
-        using observation_func_t     = numeric_vector<M_> (*)(const numeric_vector<N_> &x);
-        using observation_jacobian_t = numeric_matrix<M_, N_> (*)(const numeric_vector<N_> &x);
-
     protected:
-        const state_func_t f_;             // state-transition model
-        const state_jacobian_t Fj_;        // state-transition Jacobian
-        const observation_func_t h_;       // measurement model
-        const observation_jacobian_t Hj_;  // measurement Jacobian
-        numeric_matrix<N_, N_> &Q_;        // covariance of the process noise
-        numeric_matrix<M_, M_> &R_;        // covariance of the measurement noise
+        const numeric_matrix<N_, N_> &F_;  // state-transition model
+        const numeric_matrix<N_, L_> &B_;  // control-input model
+        const numeric_matrix<M_, N_> &H_;  // measurement model
+        numeric_matrix<N_, M_> K_;         // steady-state Kalman gain
+        numeric_matrix<N_, N_> Phi_;       // closed-loop transition (I - K H) F
+        numeric_matrix<N_, L_> Gamma_;     // closed-loop control input (I - K H) B
         numeric_vector<N_> x_;             // state vector
-        numeric_matrix<N_, N_> P_;         // state covariance, self-initialized as Q_
-        const real_t alpha_;               // EMA Smoothing factor for R
-        const real_t beta_;                // EMA Smoothing factor for Q
 
     public:
-        constexpr adaptive_extended_kalman_filter_t(
-                const state_func_t f_vec_func,
-                const state_jacobian_t Fj_mat_func,
-                const observation_func_t h_vec_func,
-                const observation_jacobian_t Hj_mat_func,
-                numeric_matrix<N_, N_> &Q_matrix,
-                numeric_matrix<M_, M_> &R_matrix,
-                const numeric_vector<N_> &x_0,
-                const real_t &alpha = 0.1,
-                const real_t &beta  = 0.1)
-            : f_(f_vec_func), Fj_{Fj_mat_func}, h_{h_vec_func}, Hj_{Hj_mat_func},
-              Q_{Q_matrix}, R_{R_matrix}, x_{x_0}, P_{Q_matrix},
-              alpha_{alpha}, beta_{beta} {}
-
-        constexpr adaptive_extended_kalman_filter_t(const adaptive_extended_kalman_filter_t &) = default;
-
-        constexpr adaptive_extended_kalman_filter_t(adaptive_extended_kalman_filter_t &&) noexcept = default;
+        /**
+         * Steady-state Kalman filter constructor
+         *
+         * @param F_matrix state-transition model
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         */
+        steady_state_kalman_filter_t(
+                const numeric_matrix<N_, N_> &F_matrix,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<M_, N_> &H_matrix,
+                const numeric_matrix<N_, N_> &Q_matrix,
+                const numeric_matrix<M_, M_> &R_matrix,
+                const numeric_vector<N_> &x_0)
+            : F_{F_matrix}, B_{B_matrix}, H_{H_matrix},
+              K_{steady_state_gain(F_matrix, H_matrix, Q_matrix, R_matrix)},
+              Phi_{(numeric_matrix<N_, N_>::identity() - K_ * H_matrix) * F_matrix},
+              Gamma_{(numeric_matrix<N_, N_>::identity() - K_ * H_matrix) * B_matrix},
+              x_{x_0} {}
 
-        adaptive_extended_kalman_filter_t &operator=(const adaptive_extended_kalman_filter_t &) = default;
+        steady_state_kalman_filter_t(const steady_state_kalman_filter_t &) = default;
 
-        adaptive_extended_kalman_filter_t &operator=(adaptive_extended_kalman_filter_t &&) noexcept = default;
+        steady_state_kalman_filter_t(steady_state_kalman_filter_t &&) noexcept = default;
 
-        adaptive_extended_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
-            x_                        = vt::move(f_(x_, u));
-            numeric_matrix<N_, N_> F_ = vt::move(Fj_(x_, u));
-            P_                        = vt::move(F_ * P_.matmul_T(F_) + Q_);
+        /**
+         * Kalman filter prediction
+         *
+         * @param u control input vector
+         */
+        steady_state_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            x_ = vt::move(F_ * x_ + B_ * u);
             return *this;
         }
 
-        adaptive_extended_kalman_filter_t &update(const numeric_vector<M_> &z) {
-            numeric_vector<M_> y_          = vt::move(z - h_(x_));
-            numeric_matrix<M_, N_> Hjx_    = vt::move(Hj_(x_));
-            numeric_matrix<N_, M_> P_Hjx_t = vt::move(P_.matmul_T(Hjx_));
-            numeric_matrix<M_, M_> S_      = vt::move(Hjx_ * P_Hjx_t + R_);
-            numeric_matrix<N_, M_> K_      = vt::move(P_Hjx_t * S_.inverse());
-
-            x_ += K_ * y_;
-            P_ = vt::move((numeric_matrix<N_, N_>::identity() - K_ * Hj_(x_)) * P_);
-
-            numeric_matrix<M_, 1> y_mat = y_.as_matrix_col();
-            numeric_matrix<M_, M_> y_yT = y_mat.matmul_T(y_mat);
-
-            adapt_R(y_yT, S_);
-            adapt_Q(K_, y_yT);
+        /**
+         * Kalman filter update with the steady-state gain
+         *
+         * @param z Measurement vector
+         */
+        steady_state_kalman_filter_t &update(const numeric_vector<M_> &z) {
+            x_ += K_ * (z - H_ * x_);
+            return *this;
+        }
 
+        /**
+         * Fused prediction and update x = Phi x + Gamma u + K z
+         *
+         * @param z Measurement vector
+         * @param u control input vector
+         */
+        steady_state_kalman_filter_t &step(const numeric_vector<M_> &z, const numeric_vector<L_> &u = {}) {
+            x_ = vt::move(Phi_ * x_ + Gamma_ * u + K_ * z);
             return *this;
         }
 
-        adaptive_extended_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
-            return predict().update(z);
+        steady_state_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+            return step(z);
         }
 
         template<typename... Ts>
-        adaptive_extended_kalman_filter_t &update(const Ts &...vs) { return update(make_numeric_vector({vs...})); }
-
-        const numeric_vector<N_> &state_vector = x_;
-        const real_t &state                    = x_[0];
-        const numeric_matrix<M_, M_> &R        = R_;
-        const numeric_matrix<N_, N_> &Q        = Q_;
+        steady_state_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
 
-    private:
-        void adapt_R(const numeric_matrix<M_, M_> &y_yT, const numeric_matrix<M_, M_> &S) {
-            R_ = (1 - alpha_) * R_ + alpha_ * (y_yT + S);
-        }
+        const numeric_vector<N_> &state_vector() const { return x_; }
 
-        void adapt_Q(const numeric_matrix<N_, M_> &K, const numeric_matrix<M_, M_> &y_yT) {
-            Q_ = (1 - beta_) * Q_ + beta_ * (K * y_yT * K.transpose());
-        }
+        const numeric_matrix<N_, M_> &gain() const { return K_; }
     };
 
     namespace future {
-        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension>
+        /**
+         * Scaled unscented transform parameters (alpha, beta, kappa).\n
+         * Custom parameters are passed as a struct with the same static constexpr members.
+         */
+        struct unscented_params_t {
+            static constexpr real_t alpha = 0.5;
+            static constexpr real_t beta  = 2.;
+            static constexpr real_t kappa = 0.;
+        };
+
+        template<size_t N, size_t L>
+        using unscented_state_func_t = numeric_vector<N> (*)(const numeric_vector<N> &x, const numeric_vector<L> &u);
+
+        template<size_t N, size_t M>
+        using unscented_observation_func_t = numeric_vector<M> (*)(const numeric_vector<N> &x);
+
+        /**
+         * Unscented Kalman filter with 2N + 1 sigma points.\n
+         * Weights are compile-time constants from Params, sigma points are drawn from the Cholesky factor
+         * of (N + lambda) P into a member buffer, and f and h are any callables, inlined when
+         * passed as lambdas or function objects.
+         *
+         * @tparam StateVectorDimension State vector dimension
+         * @tparam MeasurementVectorDimension Measurement vector dimension
+         * @tparam ControlVectorDimension Control vector dimension
+         * @tparam StateFunc callable x = f(x, u)
+         * @tparam ObservationFunc callable z = h(x)
+         * @tparam Params unscented transform parameters
+         */
+        template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension,
+                 typename StateFunc       = unscented_state_func_t<StateVectorDimension, ControlVectorDimension>,
+                 typename ObservationFunc = unscented_observation_func_t<StateVectorDimension, MeasurementVectorDimension>,
+                 typename Params          = unscented_params_t>
         class unscented_kalman_filter_t {
         private:
             // Note that numeric_matrix<N_, M_> maps from R_^M_ to R_^N_
@@ -396,33 +1991,144 @@ namespace vt {
             static constexpr size_t M_ = MeasurementVectorDimension;    // Alias
             static constexpr size_t L_ = ControlVectorDimension;        // Alias
             static constexpr size_t Z_ = 2 * StateVectorDimension + 1;  // Sigma Points
-        public:
-            typedef numeric_vector<N_> (*state_func_t)(const numeric_vector<N_> &x, const numeric_vector<L_> &u);
 
-            typedef numeric_vector<M_> (*observation_func_t)(const numeric_vector<N_> &x);
+        public:
+            static constexpr real_t lambda = Params::alpha * Params::alpha * (N_ + Params::kappa) - N_;
+            static constexpr real_t Wm_0   = lambda / (N_ + lambda);                                     // mean weight of center
+            static constexpr real_t Wc_0   = Wm_0 + 1 - Params::alpha * Params::alpha + Params::beta;  // covariance weight of center
+            static constexpr real_t W_i    = 1 / (2 * (N_ + lambda));                                    // weight of other points
 
         protected:
-            const state_func_t f_;             // state-transition model
-            const observation_func_t h_;       // measurement model
+            StateFunc f_;                      // state-transition model
+            ObservationFunc h_;                // measurement model
             const numeric_matrix<N_, N_> &Q_;  // covariance of the process noise
             const numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
             numeric_vector<N_> x_;             // state vector
             numeric_matrix<N_, N_> P_;         // state covariance, self-initialized as Q_
+            numeric_matrix<Z_, N_> X_;         // state sigma points, one per row
+            numeric_matrix<Z_, M_> Y_;         // measurement sigma points, one per row
 
         public:
-            void predict() {
+            /**
+             * Unscented Kalman filter constructor
+             *
+             * @param f_func state-transition model
+             * @param h_func measurement model
+             * @param Q_matrix covariance of the process noise
+             * @param R_matrix covariance of the measurement noise
+             * @param x_0 initial state vector
+             */
+            unscented_kalman_filter_t(
+                    const StateFunc &f_func,
+                    const ObservationFunc &h_func,
+                    const numeric_matrix<N_, N_> &Q_matrix,
+                    const numeric_matrix<M_, M_> &R_matrix,
+                    const numeric_vector<N_> &x_0)
+                : f_{f_func}, h_{h_func}, Q_{Q_matrix}, R_{R_matrix}, x_{x_0}, P_{Q_matrix} {}
+
+            unscented_kalman_filter_t(const unscented_kalman_filter_t &) = default;
+
+            unscented_kalman_filter_t(unscented_kalman_filter_t &&) noexcept = default;
+
+            /**
+             * Unscented Kalman filter prediction
+             *
+             * @param u control input vector
+             */
+            unscented_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
+                cp_sigma();
+                for (size_t i = 0; i < Z_; ++i) X_[i] = vt::move(f_(X_[i], u));
+
+                x_ = vt::move(X_[0] * Wm_0);
+                for (size_t i = 1; i < Z_; ++i) x_ += X_[i] * W_i;
+
+                P_ = Q_;
+                for (size_t i = 0; i < Z_; ++i) {
+                    const numeric_vector<N_> dx = vt::move(X_[i] - x_);
+                    P_ += dx.outer(dx) * (i == 0 ? Wc_0 : W_i);
+                }
+                return *this;
+            }
+
+            /**
+             * Unscented Kalman filter update
+             *
+             * @param z Measurement vector
+             */
+            unscented_kalman_filter_t &update(const numeric_vector<M_> &z) {
+                cp_sigma();
+                for (size_t i = 0; i < Z_; ++i) Y_[i] = vt::move(h_(X_[i]));
+
+                numeric_vector<M_> z_hat = vt::move(Y_[0] * Wm_0);
+                for (size_t i = 1; i < Z_; ++i) z_hat += Y_[i] * W_i;
+
+                numeric_matrix<M_, M_> S_  = R_;
+                numeric_matrix<M_, N_> Pzx = {};
+                for (size_t i = 0; i < Z_; ++i) {
+                    const real_t w              = i == 0 ? Wc_0 : W_i;
+                    const numeric_vector<M_> dz = vt::move(Y_[i] - z_hat);
+                    S_ += dz.outer(dz) * w;
+                    Pzx += dz.outer(X_[i] - x_) * w;
+                }
+
+                // K = Pxz S^-1, solved as K^T = S^-1 Pzx since S is symmetric
+                const numeric_matrix<M_, N_> K_t = vt::move(S_.solve(Pzx));
+                x_ += K_t.transpose() * (z - z_hat);
+                P_ -= K_t.transpose() * Pzx;
+                return *this;
             }
 
-            void update() {
+            unscented_kalman_filter_t &operator<<(const numeric_vector<M_> &z) {
+                return predict().update(z);
             }
 
+            template<typename... Ts>
+            unscented_kalman_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+            const numeric_vector<N_> &state_vector() const { return x_; }
+
+            const numeric_matrix<N_, N_> &covariance() const { return P_; }
+
         protected:
+            /**
+             * Draws sigma points x and x +- columns of chol((N + lambda) P) into X_.
+             */
             void cp_sigma() {
-            }
-
-            void cp_weight() {
+                const numeric_matrix<N_, N_> S_ = vt::move((P_ * (N_ + lambda)).cholesky());
+                X_[0]                           = x_;
+                for (size_t j = 0; j < N_; ++j) {
+                    for (size_t i = 0; i < N_; ++i) {
+                        X_[1 + j][i]      = x_[i] + S_[i][j];
+                        X_[1 + N_ + j][i] = x_[i] - S_[i][j];
+                    }
+                }
             }
         };
+
+        /**
+         * Creates unscented Kalman filter deducing the callable types of f and h.
+         *
+         * @tparam N State vector dimension
+         * @tparam M Measurement vector dimension
+         * @tparam L Control vector dimension
+         * @tparam Params unscented transform parameters
+         * @tparam StateFunc
+         * @tparam ObservationFunc
+         * @param f_func state-transition model
+         * @param h_func measurement model
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @return Unscented Kalman filter
+         */
+        template<size_t N, size_t M, size_t L, typename Params = unscented_params_t,
+                 typename StateFunc, typename ObservationFunc>
+        unscented_kalman_filter_t<N, M, L, StateFunc, ObservationFunc, Params>
+        make_unscented_kalman_filter(StateFunc f_func, ObservationFunc h_func,
+                                     const numeric_matrix<N, N> &Q_matrix, const numeric_matrix<M, M> &R_matrix,
+                                     const numeric_vector<N> &x_0) {
+            return {f_func, h_func, Q_matrix, R_matrix, x_0};
+        }
     }  // namespace future
 
     // Aliases
@@ -0,0 +1,404 @@
+/**
+ * @file kalman_association.h
+ * @brief Measurement gating and global nearest neighbour data association for banks of Kalman filters
+ */
+
+#ifndef VT_LINALG_KALMAN_ASSOCIATION_H
+#define VT_LINALG_KALMAN_ASSOCIATION_H
+
+#include "bounded_numeric_matrix.h"
+#include "kalman.h"
+#include "numeric_vector.h"
+#include "spatial_grid.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Global nearest neighbour (GNN) association of measurements to a bank of tracks.\n
+     * Each track is gated with the squared Mahalanobis distance d^2 = y^T S^-1 y through the Cholesky factor
+     * of S cached by the filter, so the factorization is shared with the following update_standard().
+     * Pairs inside the gate cost d^2 + ln det S, which does not favour tracks for being uncertain.
+     * The assignment maximizes the number of gated pairs and then minimizes their total cost, solved by the
+     * Hungarian method with row and column potentials in O(min(T, D)^2 max(T, D)).\n
+     * The cost matrix and solver workspace are bounded by MaxTracks and MaxMeasurements, no allocation is made.
+     *
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam MaxTracks Track capacity
+     * @tparam MaxMeasurements Measurement capacity per scan
+     */
+    template<size_t MeasurementVectorDimension, size_t MaxTracks, size_t MaxMeasurements>
+    class gnn_associator_t {
+    public:
+        static_assert(MaxTracks > 0 && MaxMeasurements > 0, "Associator needs a non-zero capacity.");
+
+        static constexpr size_t unassigned = static_cast<size_t>(-1);
+
+    private:
+        static constexpr size_t M_ = MeasurementVectorDimension;                                       // Alias
+        static constexpr size_t T_ = MaxTracks;                                                        // Alias
+        static constexpr size_t D_ = MaxMeasurements;                                                  // Alias
+        static constexpr size_t K_ = (MaxTracks > MaxMeasurements ? MaxTracks : MaxMeasurements) + 1;  // solver workspace size
+
+    protected:
+        numeric_matrix_bounded<T_, D_> cost_;  // pair costs, HUGE_VAL outside the gate
+        real_t log_det_[T_];                   // ln det S of each track
+        size_t track_to_meas_[T_];             // measurement assigned to each track
+        size_t meas_to_track_[D_];             // track assigned to each measurement
+        real_t gate_;                          // squared Mahalanobis distance threshold
+        size_t assigned_;                      // number of assigned pairs
+
+        real_t u_[K_];     // row potentials
+        real_t v_[K_];     // column potentials
+        real_t minv_[K_];  // reduced cost of the shortest path to each column
+        size_t p_[K_];     // row matched to each column, 0 when free
+        size_t way_[K_];   // previous column on the shortest path
+        bool used_[K_];    // columns in the current alternating tree
+
+    public:
+        /**
+         * GNN associator constructor
+         *
+         * @param gate Squared Mahalanobis distance threshold, a chi-square quantile with M degrees of freedom,
+         * e.g. 9.21 for 99% with M = 2
+         */
+        explicit gnn_associator_t(const real_t &gate) : gate_{gate}, assigned_{0} {}
+
+        /**
+         * Gates every measurement against every track and solves the assignment
+         *
+         * @tparam Filter Filter providing innovation_factor() and mahalanobis(z), e.g. kalman_filter_t
+         * @param tracks Predicted tracks
+         * @param track_count Number of tracks, at most MaxTracks
+         * @param z Measurements
+         * @param measurement_count Number of measurements, at most MaxMeasurements
+         */
+        template<typename Filter>
+        gnn_associator_t &associate(Filter *tracks, size_t track_count,
+                                    const numeric_vector<M_> *z, size_t measurement_count) {
+            prepare(tracks, track_count, measurement_count);
+            for (size_t t = 0; t < cost_.r(); ++t)
+                for (size_t d = 0; d < cost_.c(); ++d) gate_pair(tracks, z, t, d);
+            solve();
+            return *this;
+        }
+
+        /**
+         * Gates each measurement only against the tracks a spatial index reports nearby, then solves the assignment.\n
+         * The index must have been refreshed from the same predicted tracks, e.g. track_grid_t.
+         *
+         * @tparam Filter
+         * @tparam Index Index providing for_each_candidate(z, gate, visit), visiting candidate track indices
+         * @param tracks Predicted tracks
+         * @param track_count Number of tracks, at most MaxTracks
+         * @param z Measurements
+         * @param measurement_count Number of measurements, at most MaxMeasurements
+         * @param index Spatial index over the tracks
+         */
+        template<typename Filter, typename Index>
+        gnn_associator_t &associate(Filter *tracks, size_t track_count,
+                                    const numeric_vector<M_> *z, size_t measurement_count,
+                                    const Index &index) {
+            prepare(tracks, track_count, measurement_count);
+            for (size_t d = 0; d < cost_.c(); ++d)
+                index.for_each_candidate(z[d], gate_, [&](size_t t) {
+                    if (t < cost_.r()) gate_pair(tracks, z, t, d);
+                });
+            solve();
+            return *this;
+        }
+
+        /**
+         * Updates every assigned track with its measurement
+         *
+         * @tparam Filter
+         * @param tracks Tracks passed to associate()
+         * @param z Measurements passed to associate()
+         */
+        template<typename Filter>
+        gnn_associator_t &update(Filter *tracks, const numeric_vector<M_> *z) {
+            for (size_t t = 0; t < cost_.r(); ++t)
+                if (track_to_meas_[t] != unassigned) tracks[t].update(z[track_to_meas_[t]]);
+            return *this;
+        }
+
+        /**
+         * Sets the squared Mahalanobis distance threshold
+         *
+         * @param gate Gate threshold
+         */
+        gnn_associator_t &set_gate(const real_t &gate) {
+            gate_ = gate;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr real_t gate() const { return gate_; }
+
+        /**
+         * Measurement assigned to a track by the latest association
+         *
+         * @param track Track index
+         * @return Measurement index, or unassigned
+         */
+        [[nodiscard]] size_t measurement_of(size_t track) const { return track_to_meas_[track]; }
+
+        /**
+         * Track assigned to a measurement by the latest association
+         *
+         * @param measurement Measurement index
+         * @return Track index, or unassigned
+         */
+        [[nodiscard]] size_t track_of(size_t measurement) const { return meas_to_track_[measurement]; }
+
+        [[nodiscard]] constexpr size_t assigned() const { return assigned_; }
+
+        /**
+         * Pair costs d^2 + ln det S of the latest association, HUGE_VAL outside the gate
+         *
+         * @return Tracks x measurements cost matrix
+         */
+        const numeric_matrix_bounded<T_, D_> &cost() const { return cost_; }
+
+    private:
+        template<typename Filter>
+        void prepare(Filter *tracks, size_t track_count, size_t measurement_count) {
+            cost_.resize(vt::min(track_count, T_), vt::min(measurement_count, D_));
+            for (size_t t = 0; t < cost_.r(); ++t) {
+                const numeric_matrix<M_, M_> &L_S = tracks[t].innovation_factor();
+                log_det_[t]                       = 0;
+                for (size_t m = 0; m < M_; ++m) log_det_[t] += 2 * log(L_S[m][m]);
+                for (size_t d = 0; d < cost_.c(); ++d) cost_[t][d] = HUGE_VAL;
+            }
+        }
+
+        template<typename Filter>
+        void gate_pair(Filter *tracks, const numeric_vector<M_> *z, size_t t, size_t d) {
+            const real_t d2_ = tracks[t].mahalanobis(z[d]);
+            if (d2_ <= gate_) cost_[t][d] = d2_ + log_det_[t];
+        }
+
+        /**
+         * Hungarian method over the smaller side as rows, one shortest augmenting path per row.\n
+         * Gated-out pairs take a finite cost larger than any assignment with one more gated pair,
+         * and are dropped afterwards.
+         */
+        void solve() {
+            const size_t n_tracks = cost_.r();
+            const size_t n_meas   = cost_.c();
+            const bool transposed = n_tracks > n_meas;
+            const size_t n        = transposed ? n_meas : n_tracks;
+            const size_t m        = transposed ? n_tracks : n_meas;
+
+            for (size_t t = 0; t < n_tracks; ++t) track_to_meas_[t] = unassigned;
+            for (size_t d = 0; d < n_meas; ++d) meas_to_track_[d] = unassigned;
+            assigned_ = 0;
+            if (n == 0) return;
+
+            real_t c_min = HUGE_VAL, c_max = -HUGE_VAL;
+            for (size_t t = 0; t < n_tracks; ++t)
+                for (size_t d = 0; d < n_meas; ++d)
+                    if (cost_[t][d] != HUGE_VAL) {
+                        c_min = vt::min(c_min, cost_[t][d]);
+                        c_max = vt::max(c_max, cost_[t][d]);
+                    }
+            if (c_max < c_min) return;  // nothing inside the gate
+            const real_t forbidden_ = c_max + (c_max - c_min + 1) * static_cast<real_t>(n);
+
+            // a(i, j) over 1-based rows i <= n and columns j <= m
+            const auto a = [&](size_t i, size_t j) {
+                const real_t c_ = transposed ? cost_[j - 1][i - 1] : cost_[i - 1][j - 1];
+                return c_ == HUGE_VAL ? forbidden_ : c_;
+            };
+
+            for (size_t j = 0; j <= m; ++j) v_[j] = p_[j] = way_[j] = 0;
+            for (size_t i = 0; i <= n; ++i) u_[i] = 0;
+
+            for (size_t i = 1; i <= n; ++i) {
+                p_[0]     = i;
+                size_t j0 = 0;
+                for (size_t j = 0; j <= m; ++j) {
+                    minv_[j] = HUGE_VAL;
+                    used_[j] = false;
+                }
+                do {
+                    used_[j0]       = true;
+                    const size_t i0 = p_[j0];
+                    real_t delta_   = HUGE_VAL;
+                    size_t j1       = 0;
+                    for (size_t j = 1; j <= m; ++j) {
+                        if (used_[j]) continue;
+                        const real_t cur_ = a(i0, j) - u_[i0] - v_[j];
+                        if (cur_ < minv_[j]) {
+                            minv_[j] = cur_;
+                            way_[j]  = j0;
+                        }
+                        if (minv_[j] < delta_) {
+                            delta_ = minv_[j];
+                            j1     = j;
+                        }
+                    }
+                    for (size_t j = 0; j <= m; ++j) {
+                        if (used_[j]) {
+                            u_[p_[j]] += delta_;
+                            v_[j] -= delta_;
+                        } else {
+                            minv_[j] -= delta_;
+                        }
+                    }
+                    j0 = j1;
+                } while (p_[j0] != 0);
+                do {
+                    const size_t j1 = way_[j0];
+                    p_[j0]          = p_[j1];
+                    j0              = j1;
+                } while (j0 != 0);
+            }
+
+            for (size_t j = 1; j <= m; ++j) {
+                if (p_[j] == 0) continue;
+                const size_t t = transposed ? j - 1 : p_[j] - 1;
+                const size_t d = transposed ? p_[j] - 1 : j - 1;
+                if (cost_[t][d] == HUGE_VAL) continue;
+                track_to_meas_[t] = d;
+                meas_to_track_[d] = t;
+                ++assigned_;
+            }
+        }
+    };
+
+    /**
+     * Spatial index over the predicted measurements of a bank of tracks, for gating at scale.\n
+     * Each refresh after predict() places every track at the first Dims components of its predicted
+     * measurement in a spatial_grid_t, so tracks that stay in their cell cost no relinking.
+     * A gate d^2 <= g implies |y|^2 <= g tr(S), since tr(S) bounds the largest eigenvalue of S, so a
+     * measurement only needs to be gated against tracks within that radius. Tracks whose gate radius
+     * exceeds a cell are kept out of the grid in an overflow list that every query checks directly, so a
+     * few diverged or newly initiated tracks cannot widen the query of the whole bank. A cell size near
+     * sqrt(g tr(S)) of a typical track works well.
+     *
+     * @tparam Dims Indexed measurement components, at most the measurement dimension
+     * @tparam MaxTracks Track capacity
+     * @tparam Buckets Number of hash chains
+     */
+    template<size_t Dims, size_t MaxTracks, size_t Buckets = MaxTracks>
+    class track_grid_t {
+    private:
+        static constexpr size_t D_ = Dims;       // Alias
+        static constexpr size_t T_ = MaxTracks;  // Alias
+
+    protected:
+        spatial_grid_t<D_, T_, Buckets> grid_;  // tracks by predicted position
+        numeric_vector<D_> position_[T_];       // indexed components of each predicted measurement
+        real_t spread_[T_];                     // tr(S) of each track
+        size_t overflow_[T_];                   // tracks whose gate radius exceeds a cell, kept out of the grid
+        real_t gate_;                           // gate used to split gridded and overflow tracks
+        real_t spread_max_;                     // largest tr(S) among the gridded tracks
+        size_t count_;                          // number of indexed tracks
+        size_t overflow_count_;                 // number of overflow tracks
+        size_t moved_;                          // tracks that changed cell in the latest refresh
+
+    public:
+        /**
+         * Track index constructor
+         *
+         * @param cell_size Grid cell edge length in measurement units
+         * @param gate Squared Mahalanobis distance threshold the index is queried with, e.g. the associator gate
+         */
+        track_grid_t(const real_t &cell_size, const real_t &gate)
+            : grid_{cell_size}, gate_{gate}, spread_max_{0}, count_{0}, overflow_count_{0}, moved_{0} {}
+
+        /**
+         * Moves every track to its predicted position, removing tracks beyond track_count
+         *
+         * @tparam Filter Filter providing innovation_factor() and predicted_measurement(), e.g. kalman_filter_t
+         * @param tracks Predicted tracks
+         * @param track_count Number of tracks, at most MaxTracks
+         */
+        template<typename Filter>
+        track_grid_t &refresh(Filter *tracks, size_t track_count) {
+            track_count = vt::min(track_count, T_);
+            for (size_t t = track_count; t < count_; ++t) grid_.remove(t);
+
+            const real_t cell_ = grid_.cell_size();
+            spread_max_        = 0;
+            overflow_count_    = 0;
+            moved_             = 0;
+            for (size_t t = 0; t < track_count; ++t) {
+                spread_[t] = trace_of(tracks[t].innovation_factor());
+                project(tracks[t].predicted_measurement(), position_[t]);
+                if (gate_ * spread_[t] > cell_ * cell_) {
+                    grid_.remove(t);
+                    overflow_[overflow_count_++] = t;
+                    continue;
+                }
+                spread_max_ = vt::max(spread_max_, spread_[t]);
+                moved_ += grid_.place(t, position_[t]);
+            }
+            count_ = track_count;
+            return *this;
+        }
+
+        /**
+         * Visits the tracks whose gate may contain a measurement.\n
+         * The grid is searched within the largest gate radius of the gridded tracks, overflow tracks are tested directly.
+         *
+         * @tparam M Measurement vector dimension
+         * @tparam Visitor Callable as visit(track)
+         * @param z Measurement vector
+         * @param gate Squared Mahalanobis distance threshold
+         * @param visit Visitor
+         */
+        template<size_t M, typename Visitor>
+        void for_each_candidate(const numeric_vector<M> &z, const real_t &gate, Visitor &&visit) const {
+            numeric_vector<D_> p_;
+            project(z, p_);
+            const auto within_ = [&](size_t t) {
+                real_t r2_ = 0;
+                for (size_t d = 0; d < D_; ++d) r2_ += (p_[d] - position_[t][d]) * (p_[d] - position_[t][d]);
+                return r2_ <= gate * spread_[t];
+            };
+            grid_.query(p_, sqrt(gate * spread_max_), [&](size_t t) {
+                if (within_(t)) visit(t);
+            });
+            for (size_t i = 0; i < overflow_count_; ++i)
+                if (within_(overflow_[i])) visit(overflow_[i]);
+        }
+
+        [[nodiscard]] constexpr size_t size() const { return count_; }
+
+        /**
+         * Number of tracks that changed cell in the latest refresh, the rest were not relinked
+         *
+         * @return Moved track count
+         */
+        [[nodiscard]] constexpr size_t moved() const { return moved_; }
+
+        /**
+         * Number of tracks whose gate radius exceeded a cell in the latest refresh, tested on every query
+         *
+         * @return Overflow track count
+         */
+        [[nodiscard]] constexpr size_t overflow() const { return overflow_count_; }
+
+        const spatial_grid_t<D_, T_, Buckets> &grid() const { return grid_; }
+
+    private:
+        /**
+         * tr(S) = tr(L L^T), the sum of squared entries of the Cholesky factor
+         */
+        template<size_t M>
+        static real_t trace_of(const numeric_matrix<M, M> &L_S) {
+            real_t tr_ = 0;
+            for (size_t i = 0; i < M; ++i)
+                for (size_t j = 0; j <= i; ++j) tr_ += L_S[i][j] * L_S[i][j];
+            return tr_;
+        }
+
+        template<size_t M>
+        static void project(const numeric_vector<M> &z, numeric_vector<D_> &p) {
+            static_assert(D_ <= M, "Indexed components exceed the measurement dimension.");
+            for (size_t d = 0; d < D_; ++d) p[d] = z[d];
+        }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_ASSOCIATION_H
@@ -0,0 +1,161 @@
+/**
+ * @file kalman_diagnostics.h
+ * @brief Filter consistency statistics: NIS, NEES and windowed chi-square tests
+ */
+
+#ifndef VT_LINALG_KALMAN_DIAGNOSTICS_H
+#define VT_LINALG_KALMAN_DIAGNOSTICS_H
+
+#include "circular_buffer.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Chi-square quantile by the Wilson-Hilferty approximation,
+     * k (1 - 2 / (9k) + z sqrt(2 / (9k)))^3, within about 1% of the exact value for k >= 3
+     *
+     * @param dof Degrees of freedom k
+     * @param z Standard normal quantile, e.g. -1.96 and 1.96 for a two-sided 95% interval
+     * @return Approximate chi-square quantile
+     */
+    inline real_t chi_square_quantile(const real_t &dof, const real_t &z) {
+        const real_t c_ = 2 / (9 * dof);
+        const real_t r_ = 1 - c_ + z * sqrt(c_);
+        return r_ > 0 ? dof * r_ * r_ * r_ : 0;
+    }
+
+    /**
+     * Normalized estimation error squared e^T P^-1 e of a state error against the filter covariance
+     *
+     * @tparam N State vector dimension
+     * @param error Estimate minus true state
+     * @param P State covariance
+     * @return NEES
+     */
+    template<size_t N>
+    real_t nees(const numeric_vector<N> &error, const numeric_matrix<N, N> &P) {
+        const numeric_vector<N> w_ = vt::move(P.cholesky().solve_lower(error));
+        return w_.dot(w_);
+    }
+
+    /**
+     * Moving window over the latest Window samples of a chi-square statistic with a fixed number of
+     * degrees of freedom per sample, e.g. NIS (M) or NEES (N). The window sum is kept incrementally,
+     * and a consistent filter keeps it inside the chi-square interval with Window * dof degrees of freedom.
+     *
+     * @tparam Window Number of samples
+     */
+    template<size_t Window>
+    class chi_square_window_t {
+    public:
+        static_assert(Window > 0, "Window must not be empty.");
+
+    protected:
+        circular_buffer_static_t<real_t, Window> samples_;  // latest samples
+        real_t sum_;                                        // sum over the window
+        size_t dof_;                                        // degrees of freedom of one sample
+
+    public:
+        /**
+         * Window constructor
+         *
+         * @param dof Degrees of freedom of one sample
+         */
+        explicit chi_square_window_t(size_t dof) : sum_{0}, dof_{dof} {}
+
+        chi_square_window_t &push(const real_t &sample) {
+            if (samples_.full()) sum_ -= samples_.front();
+            samples_.push_overwrite(sample);
+            sum_ += sample;
+            return *this;
+        }
+
+        void clear() {
+            samples_.clear();
+            sum_ = 0;
+        }
+
+        [[nodiscard]] constexpr real_t sum() const { return sum_; }
+
+        /**
+         * Average sample, dof for a consistent filter
+         *
+         * @return Window mean
+         */
+        [[nodiscard]] real_t mean() const { return samples_.empty() ? 0 : sum_ / static_cast<real_t>(samples_.size()); }
+
+        [[nodiscard]] constexpr size_t size() const { return samples_.size(); }
+
+        /**
+         * Degrees of freedom of the window sum
+         *
+         * @return Samples in the window times dof per sample
+         */
+        [[nodiscard]] constexpr size_t dof() const { return samples_.size() * dof_; }
+
+        /**
+         * Two-sided chi-square test of the window sum
+         *
+         * @param z Standard normal quantile of the interval, 1.96 for 95%
+         * @return Whether the window sum lies inside the interval, true while empty
+         */
+        [[nodiscard]] bool is_consistent(const real_t &z = 1.96) const {
+            if (samples_.empty()) return true;
+            const real_t k_ = static_cast<real_t>(dof());
+            return sum_ >= chi_square_quantile(k_, -z) && sum_ <= chi_square_quantile(k_, z);
+        }
+    };
+
+    /**
+     * Diagnostics policy recording the innovation of every update, for kalman_filter_t and
+     * extended_kalman_filter_t, e.g. kalman_filter_t<4, 2, 1, innovation_monitor_t<2, 50>>.\n
+     * The NIS is y^T S^-1 y from the same Cholesky factor (or scalar decorrelation) that computed the gain,
+     * and S itself is rebuilt from the factor only when asked for.
+     *
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam Window Number of updates in the chi-square window
+     */
+    template<size_t MeasurementVectorDimension, size_t Window>
+    class innovation_monitor_t {
+    public:
+        static constexpr bool enabled = true;
+
+    private:
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+    protected:
+        numeric_vector<M_> y_;                // innovation of the latest update
+        numeric_matrix<M_, M_> L_S_;          // Cholesky factor of its covariance
+        real_t nis_;                          // normalized innovation squared of the latest update
+        chi_square_window_t<Window> window_;  // NIS over the latest Window updates
+
+    public:
+        innovation_monitor_t() : nis_{0}, window_{M_} {}
+
+        void record(const numeric_vector<M_> &y, const numeric_matrix<M_, M_> &L_S, const real_t &nis) {
+            y_   = y;
+            L_S_ = L_S;
+            nis_ = nis;
+            window_.push(nis);
+        }
+
+        const numeric_vector<M_> &innovation() const { return y_; }
+
+        const numeric_matrix<M_, M_> &innovation_factor() const { return L_S_; }
+
+        /**
+         * Innovation covariance of the latest update, S = L L^T
+         *
+         * @return Innovation covariance
+         */
+        numeric_matrix<M_, M_> innovation_covariance() const { return L_S_.matmul_T(L_S_); }
+
+        [[nodiscard]] constexpr real_t nis() const { return nis_; }
+
+        const chi_square_window_t<Window> &window() const { return window_; }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_DIAGNOSTICS_H
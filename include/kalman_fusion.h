@@ -0,0 +1,195 @@
+/**
+ * @file kalman_fusion.h
+ * @brief Kalman filter fusing several sensors with their own measurement models
+ */
+
+#ifndef VT_LINALG_KALMAN_FUSION_H
+#define VT_LINALG_KALMAN_FUSION_H
+
+#include "kalman.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Measurement model of one sensor, binding its H and R without copying.\n
+     * Sensors sharing dimensions are told apart by Tag, e.g.
+     * using gps_t = sensor_model_t<9, 3, struct gps_tag>;
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension of this sensor
+     * @tparam Tag Distinguishing type
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, typename Tag = void>
+    class sensor_model_t {
+    public:
+        static constexpr size_t state_dimension       = StateVectorDimension;
+        static constexpr size_t measurement_dimension = MeasurementVectorDimension;
+
+        using tag = Tag;
+
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+
+    protected:
+        const numeric_matrix<M_, N_> &H_;  // measurement model
+        const numeric_matrix<M_, M_> &R_;  // covariance of the measurement noise
+        bool sequential_;                  // process measurements one scalar at a time
+
+    public:
+        /**
+         * Sensor model constructor
+         *
+         * @param H_matrix measurement model
+         * @param R_matrix covariance of the measurement noise
+         */
+        sensor_model_t(const numeric_matrix<M_, N_> &H_matrix, const numeric_matrix<M_, M_> &R_matrix)
+            : H_{H_matrix}, R_{R_matrix}, sequential_{R_matrix.is_diagonal()} {}
+
+        const numeric_matrix<M_, N_> &H() const { return H_; }
+
+        const numeric_matrix<M_, M_> &R() const { return R_; }
+
+        /**
+         * Whether updates run as M scalar updates, set when R is diagonal at construction
+         *
+         * @return
+         */
+        [[nodiscard]] constexpr bool is_sequential() const { return sequential_; }
+    };
+
+    namespace detail {
+        /**
+         * Holds one instance of each sensor model, each list entry a base of the previous one.
+         */
+        template<typename... Sensors>
+        struct sensor_set_t {
+            sensor_set_t() = default;
+        };
+
+        template<typename Sensor, typename... Rest>
+        struct sensor_set_t<Sensor, Rest...> : sensor_set_t<Rest...> {
+            Sensor sensor;
+
+            sensor_set_t(const Sensor &s, const Rest &...rest) : sensor_set_t<Rest...>(rest...), sensor(s) {}
+        };
+
+        /**
+         * Selects the sensor of type Sensor by conversion to the base holding it.
+         * Fails to compile if Sensor is missing from the list or listed twice.
+         */
+        template<typename Sensor, typename... Rest>
+        const Sensor &get_sensor(const sensor_set_t<Sensor, Rest...> &set) { return set.sensor; }
+    }  // namespace detail
+
+    /**
+     * Kalman filter over a shared state fed by a compile-time list of sensors.\n
+     * update<Sensor>(z) runs only that sensor's M-dimensional path, sequentially when its R is diagonal,
+     * so sensors at different rates need neither padded measurement vectors nor separate filters.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Sensors sensor_model_t types, each listed once
+     */
+    template<size_t StateVectorDimension, size_t ControlVectorDimension, typename... Sensors>
+    class fusion_kalman_filter_t {
+    private:
+        static constexpr size_t N_ = StateVectorDimension;    // ALias
+        static constexpr size_t L_ = ControlVectorDimension;  // Alias
+
+        static_assert(sizeof...(Sensors) > 0, "Fusion filter needs at least one sensor.");
+        static_assert(((Sensors::state_dimension == StateVectorDimension) && ...), "Sensor state dimension mismatch.");
+
+    protected:
+        const numeric_matrix<N_, N_> *F_;           // state-transition model
+        const numeric_matrix<N_, L_> &B_;           // control-input model
+        const numeric_matrix<N_, N_> *Q_;           // covariance of the process noise
+        detail::sensor_set_t<Sensors...> sensors_;  // measurement models
+        numeric_vector<N_> x_;                      // state vector
+        numeric_matrix<N_, N_> P_;                  // state covariance, self-initialized as Q_
+
+    public:
+        /**
+         * Fusion Kalman filter constructor
+         *
+         * @param F_matrix state-transition model
+         * @param B_matrix control-input model
+         * @param Q_matrix covariance of the process noise
+         * @param x_0 initial state vector
+         * @param sensors measurement models, in list order
+         */
+        fusion_kalman_filter_t(
+                const numeric_matrix<N_, N_> &F_matrix,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<N_, N_> &Q_matrix,
+                const numeric_vector<N_> &x_0,
+                const Sensors &...sensors)
+            : F_{&F_matrix}, B_{B_matrix}, Q_{&Q_matrix},
+              sensors_(sensors...), x_{x_0}, P_{Q_matrix} {}
+
+        /**
+         * Kalman filter prediction
+         *
+         * @param u control input vector
+         */
+        fusion_kalman_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            x_ = vt::move(*F_ * x_ + B_ * u);
+            P_ = vt::move(detail::covariance_predict(*F_, P_, *Q_));
+            return *this;
+        }
+
+        /**
+         * Rebinds the state-transition model and the process noise covariance without copying.\n
+         * Both matrices must outlive their use by this filter.
+         *
+         * @param F_matrix state-transition model
+         * @param Q_matrix covariance of the process noise
+         */
+        fusion_kalman_filter_t &use_model(const numeric_matrix<N_, N_> &F_matrix, const numeric_matrix<N_, N_> &Q_matrix) {
+            F_ = &F_matrix;
+            Q_ = &Q_matrix;
+            return *this;
+        }
+
+        /**
+         * Update with a measurement of one sensor
+         *
+         * @tparam Sensor Sensor model type from the list
+         * @param z Measurement vector of that sensor
+         */
+        template<typename Sensor>
+        fusion_kalman_filter_t &update(const numeric_vector<Sensor::measurement_dimension> &z) {
+            constexpr size_t M_ = Sensor::measurement_dimension;
+
+            const Sensor &sensor_           = detail::get_sensor<Sensor>(sensors_);
+            const numeric_matrix<M_, N_> &H = sensor_.H();
+            const numeric_matrix<M_, M_> &R = sensor_.R();
+
+            if (sensor_.is_sequential()) {
+                for (size_t j = 0; j < M_; ++j) {
+                    const numeric_vector<N_> &h_ = H[j];
+                    detail::scalar_update(x_, P_, h_, z[j] - h_.dot(x_), R[j][j]);
+                }
+                return *this;
+            }
+
+            const numeric_matrix<N_, M_> P_H_t = vt::move(P_.matmul_T(H));
+            const numeric_matrix<M_, M_> L_S   = vt::move((H * P_H_t + R).cholesky());
+            detail::cholesky_update(x_, P_, P_H_t, L_S, z - H * x_);
+            return *this;
+        }
+
+        template<typename Sensor>
+        const Sensor &sensor() const { return detail::get_sensor<Sensor>(sensors_); }
+
+        const numeric_vector<N_> &state_vector() const { return x_; }
+
+        const numeric_matrix<N_, N_> &covariance() const { return P_; }
+
+        [[nodiscard]] static constexpr size_t sensor_count() { return sizeof...(Sensors); }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_FUSION_H
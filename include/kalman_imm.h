@@ -0,0 +1,208 @@
+/**
+ * @file kalman_imm.h
+ * @brief Interacting Multiple Model estimator
+ */
+
+#ifndef VT_LINALG_KALMAN_IMM_H
+#define VT_LINALG_KALMAN_IMM_H
+
+#include "kalman.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Interacting Multiple Model estimator over Models linear motion models sharing one state layout.\n
+     * Lower-order models are embedded in the common state by zeroing their unused rows of F and Q,
+     * e.g. constant velocity next to constant acceleration over (p, v, a).\n
+     * Each cycle mixes the model estimates through the Markov mode transition matrix, runs every model's
+     * Kalman step in its own workspace, reweights the mode probabilities by the innovation likelihoods
+     * and combines the estimates. All models have the same dimensions, so the per-model workspaces are
+     * laid out as parallel lanes and processed in one loop per stage.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Models Number of motion models
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension, size_t Models>
+    class imm_filter_t {
+    public:
+        static_assert(Models > 0, "IMM needs at least one model.");
+
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+        static constexpr size_t K_ = Models;                      // Alias
+
+    protected:
+        const numeric_matrix<N_, N_> *F_;   // state-transition models, one per mode
+        const numeric_matrix<N_, N_> *Q_;   // covariances of the process noise, one per mode
+        const numeric_matrix<N_, L_> &B_;   // control-input model
+        const numeric_matrix<M_, N_> &H_;   // measurement model
+        const numeric_matrix<M_, M_> &R_;   // covariance of the measurement noise
+        const numeric_matrix<K_, K_> &Pi_;  // mode transition probabilities, Pi_[i][j] = P(j | i)
+
+        numeric_vector<N_> x_[K_];          // per-model state
+        numeric_matrix<N_, N_> P_[K_];      // per-model covariance
+        numeric_vector<N_> x_mix_[K_];      // mixed initial state workspace
+        numeric_matrix<N_, N_> P_mix_[K_];  // mixed initial covariance workspace
+        numeric_vector<K_> mu_;             // mode probabilities
+        numeric_vector<K_> c_;              // predicted mode probabilities
+        numeric_vector<K_> log_lambda_;     // innovation log-likelihoods
+        numeric_vector<N_> x_out_;          // combined state
+        numeric_matrix<N_, N_> P_out_;      // combined covariance
+
+    public:
+        /**
+         * IMM estimator constructor
+         *
+         * @param F_matrices state-transition models, one per mode
+         * @param Q_matrices covariances of the process noise, one per mode
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param R_matrix covariance of the measurement noise
+         * @param Pi_matrix Markov mode transition matrix, rows sum to 1
+         * @param x_0 initial state vector of every model
+         * @param mu_0 initial mode probabilities
+         */
+        imm_filter_t(const numeric_matrix<N_, N_> (&F_matrices)[K_],
+                     const numeric_matrix<N_, N_> (&Q_matrices)[K_],
+                     const numeric_matrix<N_, L_> &B_matrix,
+                     const numeric_matrix<M_, N_> &H_matrix,
+                     const numeric_matrix<M_, M_> &R_matrix,
+                     const numeric_matrix<K_, K_> &Pi_matrix,
+                     const numeric_vector<N_> &x_0,
+                     const numeric_vector<K_> &mu_0)
+            : F_{F_matrices}, Q_{Q_matrices}, B_{B_matrix}, H_{H_matrix}, R_{R_matrix}, Pi_{Pi_matrix},
+              mu_{mu_0}, x_out_{x_0} {
+            for (size_t j = 0; j < K_; ++j) {
+                x_[j] = x_0;
+                P_[j] = Q_matrices[j];
+            }
+            combine();
+        }
+
+        /**
+         * Mixing followed by the prediction of every model
+         *
+         * @param u control input vector
+         */
+        imm_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            // c_j = sum_i Pi_ij mu_i, mu_i|j = Pi_ij mu_i / c_j
+            for (size_t j = 0; j < K_; ++j) {
+                real_t c_j = 0;
+                for (size_t i = 0; i < K_; ++i) c_j += Pi_[i][j] * mu_[i];
+                c_[j] = c_j;
+            }
+
+            for (size_t j = 0; j < K_; ++j) {
+                numeric_vector<N_> &x0_     = x_mix_[j];
+                numeric_matrix<N_, N_> &P0_ = P_mix_[j];
+                const real_t inv_c_j        = c_[j] > 0 ? 1 / c_[j] : 0;
+
+                x0_ = numeric_vector<N_>();
+                for (size_t i = 0; i < K_; ++i) x0_ += x_[i] * (Pi_[i][j] * mu_[i] * inv_c_j);
+
+                P0_ = numeric_matrix<N_, N_>();
+                for (size_t i = 0; i < K_; ++i) {
+                    const real_t w_ij          = Pi_[i][j] * mu_[i] * inv_c_j;
+                    const numeric_vector<N_> d = vt::move(x_[i] - x0_);
+                    for (size_t r = 0; r < N_; ++r)
+                        for (size_t s = 0; s < N_; ++s) P0_[r][s] += w_ij * (P_[i][r][s] + d[r] * d[s]);
+                }
+            }
+
+            for (size_t j = 0; j < K_; ++j) {
+                x_[j] = vt::move(F_[j] * x_mix_[j] + B_ * u);
+                P_[j] = vt::move(detail::covariance_predict(F_[j], P_mix_[j], Q_[j]));
+            }
+
+            mu_ = c_;
+            combine();
+            return *this;
+        }
+
+        /**
+         * Update of every model, mode probability update and combination
+         *
+         * @param z Measurement vector
+         */
+        imm_filter_t &update(const numeric_vector<M_> &z) {
+            constexpr real_t log_2pi = 1.8378770664093454836;
+
+            for (size_t j = 0; j < K_; ++j) {
+                const numeric_vector<M_> y_        = vt::move(z - H_ * x_[j]);
+                const numeric_matrix<N_, M_> P_H_t = vt::move(P_[j].matmul_T(H_));
+                const numeric_matrix<M_, M_> L_S   = vt::move((H_ * P_H_t + R_).cholesky());
+
+                // log N(y; 0, S) = -(y^T S^-1 y + log det S + M log 2 pi) / 2, with det S = prod diag(L)^2
+                const numeric_vector<M_> w_ = vt::move(L_S.solve_lower(y_));
+                real_t log_det_             = 0;
+                for (size_t m = 0; m < M_; ++m) log_det_ += 2 * log(L_S[m][m]);
+                log_lambda_[j] = -0.5 * (w_.dot(w_) + log_det_ + static_cast<real_t>(M_) * log_2pi);
+
+                detail::cholesky_update(x_[j], P_[j], P_H_t, L_S, y_);
+            }
+
+            // mu_j = Lambda_j c_j / sum, scaled by the largest likelihood to avoid underflow
+            real_t max_log_ = log_lambda_[0];
+            for (size_t j = 1; j < K_; ++j) max_log_ = vt::max(max_log_, log_lambda_[j]);
+            real_t sum_ = 0;
+            for (size_t j = 0; j < K_; ++j) {
+                mu_[j] = c_[j] * exp(log_lambda_[j] - max_log_);
+                sum_ += mu_[j];
+            }
+            if (sum_ > 0) mu_ /= sum_;
+
+            combine();
+            return *this;
+        }
+
+        imm_filter_t &operator<<(const numeric_vector<M_> &z) {
+            return predict().update(z);
+        }
+
+        template<typename... Ts>
+        imm_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+        /**
+         * Combined state over all models
+         *
+         * @return Combined state vector
+         */
+        const numeric_vector<N_> &state_vector() const { return x_out_; }
+
+        /**
+         * Combined covariance including the spread of the model estimates
+         *
+         * @return Combined covariance
+         */
+        const numeric_matrix<N_, N_> &covariance() const { return P_out_; }
+
+        const numeric_vector<K_> &mode_probabilities() const { return mu_; }
+
+        const numeric_vector<N_> &model_state(size_t j) const { return x_[j]; }
+
+        const numeric_matrix<N_, N_> &model_covariance(size_t j) const { return P_[j]; }
+
+        [[nodiscard]] static constexpr size_t models() { return K_; }
+
+    private:
+        void combine() {
+            x_out_ = numeric_vector<N_>();
+            for (size_t j = 0; j < K_; ++j) x_out_ += x_[j] * mu_[j];
+
+            P_out_ = numeric_matrix<N_, N_>();
+            for (size_t j = 0; j < K_; ++j) {
+                const numeric_vector<N_> d = vt::move(x_[j] - x_out_);
+                for (size_t r = 0; r < N_; ++r)
+                    for (size_t s = 0; s < N_; ++s) P_out_[r][s] += mu_[j] * (P_[j][r][s] + d[r] * d[s]);
+            }
+        }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_IMM_H
@@ -7,6 +7,49 @@ namespace vt {
     template<size_t M, size_t N, size_t P>
     using vkf = kalman_filter_t<M, N, P>;
 
+    /**
+     * Discrete-time model pair (F, Q) of a continuous-time model sampled over dt.
+     *
+     * @tparam N State vector dimension
+     */
+    template<size_t N>
+    struct discrete_model_t {
+        numeric_matrix<N, N> F;  // state-transition model
+        numeric_matrix<N, N> Q;  // covariance of the process noise
+    };
+
+    /**
+     * Van Loan discretization of continuous-time model dx = Ax dt + G dw, E[dw dw^T] = Qc dt.\n
+     * Builds M = [-A, G Qc G^T; 0, A^T] * dt, then F = (e^M)_22^T and Q = F * (e^M)_12.
+     *
+     * @tparam N State vector dimension
+     * @tparam W Process noise dimension
+     * @param A Continuous-time system matrix
+     * @param G Noise input matrix
+     * @param Qc Continuous-time process noise spectral density
+     * @param dt Sampling period
+     * @return Discrete-time (F, Q)
+     */
+    template<size_t N, size_t W>
+    discrete_model_t<N> van_loan(const numeric_matrix<N, N> &A,
+                                 const numeric_matrix<N, W> &G,
+                                 const numeric_matrix<W, W> &Qc,
+                                 const real_t &dt) {
+        const numeric_matrix<N, N> GQGt = vt::move((G * Qc).matmul_T(G));
+        numeric_matrix<2 * N, 2 * N> M(A * -dt, GQGt * dt, numeric_matrix<N, N>(), A.transpose() * dt);
+        const numeric_matrix<2 * N, 2 * N> E = vt::move(M.expm());
+
+        discrete_model_t<N> model;
+        model.F = vt::move((E.template slice<N, N, 2 * N, 2 * N>()).transpose());
+        model.Q = vt::move(model.F * E.template slice<0, N, N, 2 * N>());
+
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = i + 1; j < N; ++j)
+                model.Q[i][j] = model.Q[j][i] = 0.5 * (model.Q[i][j] + model.Q[j][i]);
+
+        return model;
+    }
+
     /**
      * Variable dt wrapper for Kalman filter
      *
@@ -28,7 +71,7 @@ namespace vt {
 
         void update_dt(const real_t &new_dt) { update_dt_helper<0>(new_dt); }
 
-        numeric_matrix<Degree + 1, Degree + 1> generate_F() {
+        numeric_matrix<Degree + 1, Degree + 1> generate_F() const {
             numeric_matrix<Degree + 1, Degree + 1> F_out = {};
 
             for (size_t i = 0; i < Degree + 1; ++i) {
@@ -48,32 +91,265 @@ namespace vt {
             return F_out;
         }
 
+        /**
+         * Applies x <- F * x in place without materializing F.\n
+         * F is upper-triangular Toeplitz with coefficients 1, dt, dt^2 / 2!, ..., so this costs O(N^2).
+         *
+         * @param x State vector
+         */
+        void propagate(numeric_vector<Degree + 1> &x) const {
+            for (size_t i = 0; i < Degree + 1; ++i)
+                for (size_t j = i + 1; j < Degree + 1; ++j)
+                    x[i] += m_dt[j - i - 1] * x[j];
+        }
+
+        /**
+         * Applies P <- F * P in place without materializing F.
+         *
+         * @tparam Col
+         * @param P Matrix with Degree + 1 rows
+         */
+        template<size_t Col>
+        void propagate_rows(numeric_matrix<Degree + 1, Col> &P) const {
+            for (size_t i = 0; i < Degree + 1; ++i)
+                for (size_t j = i + 1; j < Degree + 1; ++j)
+                    for (size_t k = 0; k < Col; ++k)
+                        P[i][k] += m_dt[j - i - 1] * P[j][k];
+        }
+
+        /**
+         * Applies P <- F * P * F^T in place without materializing F.\n
+         * Rows are combined first, then columns; each pass only reads entries it has not yet overwritten.
+         *
+         * @param P Covariance matrix
+         */
+        void propagate_covariance(numeric_matrix<Degree + 1, Degree + 1> &P) const {
+            propagate_rows(P);
+            for (size_t k = 0; k < Degree + 1; ++k)
+                for (size_t i = 0; i < Degree + 1; ++i)
+                    for (size_t j = i + 1; j < Degree + 1; ++j)
+                        P[k][i] += m_dt[j - i - 1] * P[k][j];
+        }
+
+        /**
+         * Continuous-time integrator chain where each state is the derivative of the previous one.
+         *
+         * @return Continuous-time system matrix A, such that F = e^(A * dt)
+         */
+        static numeric_matrix<Degree + 1, Degree + 1> generate_A() {
+            numeric_matrix<Degree + 1, Degree + 1> A_out = {};
+            for (size_t i = 0; i < Degree; ++i) A_out[i][i + 1] = 1.;
+            return A_out;
+        }
+
+        /**
+         * Discretizes the integrator chain driven by white noise on the highest derivative.
+         *
+         * @param spectral_density Continuous-time noise spectral density of the highest derivative
+         * @return Discrete-time (F, Q) for current dt
+         */
+        discrete_model_t<Degree + 1> generate_model(const real_t &spectral_density) const {
+            numeric_matrix<Degree + 1, 1> G = {};
+            G[Degree][0]                    = 1.;
+            return van_loan(generate_A(), G, numeric_matrix<1, 1>::diagonals(spectral_density), m_dt[0]);
+        }
+
     protected:
         template<size_t Index>
         void update_dt_helper(const real_t &new_dt) {
             if constexpr (Index == 0) {
                 m_dt[0] = new_dt;
                 update_dt_helper<1>(new_dt);
-            } else if constexpr (Index == 1) {
-                m_dt[1] = 0.5 * m_dt[0] * m_dt[0];
-                update_dt_helper<2>(new_dt);
             } else if constexpr (Index < Degree) {
-                m_dt[Index] = m_dt[Index - 1] * m_dt[Index - 2] / static_cast<real_t>(Index + 1);
+                // dt^(k + 1) / (k + 1)! from dt^k / k!
+                m_dt[Index] = m_dt[Index - 1] * m_dt[0] / static_cast<real_t>(Index + 1);
                 update_dt_helper<Index + 1>(new_dt);
             }
         }
     };
 
+    /**
+     * Lookup table of discrete-time models precomputed for a set of dt buckets.\n
+     * Each bucket holds F and the discretized Q, and optionally the steady-state Kalman gain.
+     * Switching a filter to another bucket rebinds its model pointers instead of rebuilding F and Q.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam Buckets Number of dt buckets
+     */
+    template<size_t N, size_t M, size_t Buckets>
+    class kalman_lut_t {
+    public:
+        static_assert(Buckets > 0, "Lookup table must have at least one bucket.");
+
+        struct entry_t {
+            real_t dt = 0.;            // sampling period of this bucket
+            numeric_matrix<N, N> F;    // state-transition model
+            numeric_matrix<N, N> Q;    // covariance of the process noise
+            numeric_matrix<N, M> K;    // steady-state Kalman gain, if precomputed
+        };
+
+    protected:
+        entry_t table_[Buckets];
+        bool has_gain_ = false;
+
+    public:
+        /**
+         * Precomputes (F, Q) for each dt using Van Loan discretization of a continuous-time model.
+         *
+         * @tparam W Process noise dimension
+         * @param dts Bucket periods, any order
+         * @param A Continuous-time system matrix
+         * @param G Noise input matrix
+         * @param Qc Continuous-time process noise spectral density
+         */
+        template<size_t W>
+        kalman_lut_t(const real_t (&dts)[Buckets],
+                     const numeric_matrix<N, N> &A,
+                     const numeric_matrix<N, W> &G,
+                     const numeric_matrix<W, W> &Qc) {
+            real_t sorted[Buckets];
+            sort_dts(dts, sorted);
+            for (size_t i = 0; i < Buckets; ++i) {
+                discrete_model_t<N> model = vt::move(van_loan(A, G, Qc, sorted[i]));
+                table_[i].dt              = sorted[i];
+                table_[i].F               = vt::move(model.F);
+                table_[i].Q               = vt::move(model.Q);
+            }
+        }
+
+        /**
+         * Precomputes (F, Q) for each dt from a model generator.
+         *
+         * @tparam ModelFunc Callable as discrete_model_t<N>(const real_t &dt)
+         * @param dts Bucket periods, any order
+         * @param model_func Model generator
+         */
+        template<typename ModelFunc>
+        kalman_lut_t(const real_t (&dts)[Buckets], ModelFunc &&model_func) {
+            real_t sorted[Buckets];
+            sort_dts(dts, sorted);
+            for (size_t i = 0; i < Buckets; ++i) {
+                discrete_model_t<N> model = vt::move(model_func(sorted[i]));
+                table_[i].dt              = sorted[i];
+                table_[i].F               = vt::move(model.F);
+                table_[i].Q               = vt::move(model.Q);
+            }
+        }
+
+        kalman_lut_t(const kalman_lut_t &) = default;
+
+        kalman_lut_t(kalman_lut_t &&) noexcept = default;
+
+        /**
+         * Precomputes steady-state Kalman gain of every bucket from its discrete algebraic Riccati equation.
+         *
+         * @param H_matrix measurement model
+         * @param R_matrix covariance of the measurement noise
+         * @return Reference to this table
+         */
+        kalman_lut_t &precompute_gain(const numeric_matrix<M, N> &H_matrix,
+                                      const numeric_matrix<M, M> &R_matrix) {
+            for (auto &entry: table_) entry.K = vt::move(steady_state_gain(entry.F, H_matrix, entry.Q, R_matrix));
+            has_gain_ = true;
+            return *this;
+        }
+
+        /**
+         * Finds index of the bucket closest to dt.
+         *
+         * @param dt Sampling period
+         * @return Bucket index
+         */
+        size_t index_of(const real_t &dt) const {
+            size_t lo = 0, hi = Buckets;
+            while (lo < hi) {
+                const size_t mid = lo + (hi - lo) / 2;
+                if (table_[mid].dt < dt) lo = mid + 1;
+                else hi = mid;
+            }
+            if (lo == Buckets) return Buckets - 1;
+            if (lo > 0 && dt - table_[lo - 1].dt <= table_[lo].dt - dt) return lo - 1;
+            return lo;
+        }
+
+        /**
+         * Nearest-bucket lookup.
+         *
+         * @param dt Sampling period
+         * @return Entry of the bucket closest to dt
+         */
+        const entry_t &nearest(const real_t &dt) const { return table_[index_of(dt)]; }
+
+        /**
+         * Linear interpolation of F and Q between the two buckets around dt,
+         * clamped to the first and last bucket.
+         *
+         * @param dt Sampling period
+         * @param F_out Interpolated state-transition model
+         * @param Q_out Interpolated covariance of the process noise
+         */
+        void interpolate(const real_t &dt, numeric_matrix<N, N> &F_out, numeric_matrix<N, N> &Q_out) const {
+            size_t hi = 0;
+            while (hi < Buckets && table_[hi].dt < dt) ++hi;
+            if (hi == 0 || hi == Buckets) {
+                const entry_t &e = table_[hi == 0 ? 0 : Buckets - 1];
+                F_out            = e.F;
+                Q_out            = e.Q;
+                return;
+            }
+            const entry_t &a = table_[hi - 1];
+            const entry_t &b = table_[hi];
+            const real_t w   = (dt - a.dt) / (b.dt - a.dt);
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < N; ++j) {
+                    F_out[i][j] = a.F[i][j] + w * (b.F[i][j] - a.F[i][j]);
+                    Q_out[i][j] = a.Q[i][j] + w * (b.Q[i][j] - a.Q[i][j]);
+                }
+            }
+        }
+
+        /**
+         * Switches the filter to the bucket closest to dt.
+         *
+         * @tparam L Control vector dimension
+         * @param kf Kalman filter
+         * @param dt Sampling period
+         * @return Entry now used by the filter
+         */
+        template<size_t L>
+        const entry_t &apply(kalman_filter_t<N, M, L> &kf, const real_t &dt) const {
+            const entry_t &e = nearest(dt);
+            kf.use_model(e.F, e.Q);
+            return e;
+        }
+
+        constexpr const entry_t &operator[](size_t index) const { return table_[index]; }
+
+        [[nodiscard]] constexpr size_t size() const { return Buckets; }
+
+        [[nodiscard]] constexpr bool has_gain() const { return has_gain_; }
+
+    private:
+        static void sort_dts(const real_t (&dts)[Buckets], real_t (&sorted)[Buckets]) {
+            for (size_t i = 0; i < Buckets; ++i) {
+                const real_t value = dts[i];
+                size_t j           = i;
+                for (; j > 0 && sorted[j - 1] > value; --j) sorted[j] = sorted[j - 1];
+                sorted[j] = value;
+            }
+        }
+    };
+
     template<size_t Order>
     class kf_pos {
     public:
         static_assert(Order > 0, "Order must be non-zero.");
 
         using vdt_type = vdt<Order - 1>;
-        using kf_type  = vkf<Order, 1, 1>;
+        using kf_type  = structured_kalman_filter_t<Order, 1, 1, vdt_type>;
 
         vdt_type ivdt;
-        numeric_matrix<Order, Order> F;
         numeric_matrix<Order, 1> B;
         numeric_matrix<1, Order> H;
         numeric_matrix<Order, Order> Q;
@@ -83,12 +359,11 @@ namespace vt {
         kf_pos(const real_t &dt, const real_t &covariance,
                const real_t &alpha, const real_t &beta)
             : ivdt{vdt_type(dt)},
-              F{ivdt.generate_F()},
               B{make_numeric_matrix<Order, 1>()},
               H{make_numeric_matrix<1, Order>({{1}})},
               Q{numeric_matrix<Order, Order>::diagonals(covariance)},
               R{numeric_matrix<1, 1>::diagonals(covariance)},
-              kf{kf_type(F, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
+              kf{kf_type(ivdt, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
 
         kf_pos(const kf_pos &) = default;
 
@@ -98,9 +373,27 @@ namespace vt {
 
         kf_pos &operator=(kf_pos &&) noexcept = default;
 
-        void update_dt(const real_t &new_dt) {
-            ivdt.update_dt(new_dt);
-            F = ivdt.generate_F();
+        /**
+         * Updates dt coefficients only. F is never materialized, kf applies it implicitly through ivdt.
+         *
+         * @param new_dt New sampling period
+         */
+        void update_dt(const real_t &new_dt) { ivdt.update_dt(new_dt); }
+
+        /**
+         * Kalman filter prediction using the implicit Toeplitz state-transition model, same as kf.predict().
+         *
+         * @param u control input vector
+         */
+        kf_pos &predict(const numeric_vector<1> &u = {}) {
+            kf.predict(u);
+            return *this;
+        }
+
+        template<typename... Ts>
+        kf_pos &update(const Ts &...vs) {
+            kf.update(vs...);
+            return *this;
         }
     };
 
@@ -110,10 +403,9 @@ namespace vt {
         static_assert(Order >= 3, "Order must be at least 3 to include acceleration.");
 
         using vdt_type = vdt<Order - 1>;
-        using kf_type  = vkf<Order, 1, 1>;
+        using kf_type  = structured_kalman_filter_t<Order, 1, 1, vdt_type>;
 
         vdt_type ivdt;
-        numeric_matrix<Order, Order> F;
         numeric_matrix<Order, 1> B;
         numeric_matrix<1, Order> H;
         numeric_matrix<Order, Order> Q;
@@ -123,12 +415,11 @@ namespace vt {
         kf_acc(const real_t &dt, const real_t &covariance,
                const real_t &alpha, const real_t &beta)
             : ivdt{vdt_type(dt)},
-              F{ivdt.generate_F()},
               B{make_numeric_matrix<Order, 1>()},
               H{make_numeric_matrix<1, Order>({{0, 0, 1}})},
               Q{numeric_matrix<Order, Order>::diagonals(covariance)},
               R{numeric_matrix<1, 1>::diagonals(covariance)},
-              kf{kf_type(F, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
+              kf{kf_type(ivdt, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
 
         kf_acc(const kf_acc &) = default;
 
@@ -138,9 +429,27 @@ namespace vt {
 
         kf_acc &operator=(kf_acc &&) noexcept = default;
 
-        void update_dt(const real_t &new_dt) {
-            ivdt.update_dt(new_dt);
-            F = ivdt.generate_F();
+        /**
+         * Updates dt coefficients only. F is never materialized, kf applies it implicitly through ivdt.
+         *
+         * @param new_dt New sampling period
+         */
+        void update_dt(const real_t &new_dt) { ivdt.update_dt(new_dt); }
+
+        /**
+         * Kalman filter prediction using the implicit Toeplitz state-transition model, same as kf.predict().
+         *
+         * @param u control input vector
+         */
+        kf_acc &predict(const numeric_vector<1> &u = {}) {
+            kf.predict(u);
+            return *this;
+        }
+
+        template<typename... Ts>
+        kf_acc &update(const Ts &...vs) {
+            kf.update(vs...);
+            return *this;
         }
     };
 
@@ -150,10 +459,9 @@ namespace vt {
         static_assert(Order >= 3, "Order must be at least 3 to include acceleration.");
 
         using vdt_type = vdt<3>;
-        using kf_type  = vkf<4, 2, 1>;
+        using kf_type  = structured_kalman_filter_t<4, 2, 1, vdt_type>;
 
         vdt_type ivdt;
-        numeric_matrix<Order, Order> F;
         numeric_matrix<Order, 1> B;
         numeric_matrix<2, Order> H;
         numeric_matrix<Order, Order> Q;
@@ -163,12 +471,11 @@ namespace vt {
         kf_pos_acc(const real_t &dt, const real_t &covariance,
                    const real_t &alpha, const real_t &beta)
             : ivdt{vdt_type(dt)},
-              F{ivdt.generate_F()},
               B{make_numeric_matrix<Order, 1>()},
               H{make_numeric_matrix<2, Order>({{1, 0, 0}, {0, 0, 1}})},
               Q{numeric_matrix<Order, Order>::diagonals(covariance)},
               R{numeric_matrix<2, 2>::diagonals(covariance)},
-              kf{kf_type(F, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
+              kf{kf_type(ivdt, B, H, Q, R, make_numeric_vector<Order>(), alpha, beta)} {}
 
         kf_pos_acc(const kf_pos_acc &) = default;
 
@@ -178,9 +485,27 @@ namespace vt {
 
         kf_pos_acc &operator=(kf_pos_acc &&) noexcept = default;
 
-        void update_dt(const real_t &new_dt) {
-            ivdt.update_dt(new_dt);
-            F = ivdt.generate_F();
+        /**
+         * Updates dt coefficients only. F is never materialized, kf applies it implicitly through ivdt.
+         *
+         * @param new_dt New sampling period
+         */
+        void update_dt(const real_t &new_dt) { ivdt.update_dt(new_dt); }
+
+        /**
+         * Kalman filter prediction using the implicit Toeplitz state-transition model, same as kf.predict().
+         *
+         * @param u control input vector
+         */
+        kf_pos_acc &predict(const numeric_vector<1> &u = {}) {
+            kf.predict(u);
+            return *this;
+        }
+
+        template<typename... Ts>
+        kf_pos_acc &update(const Ts &...vs) {
+            kf.update(vs...);
+            return *this;
         }
     };
 }  // namespace vt
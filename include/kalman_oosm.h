@@ -0,0 +1,312 @@
+/**
+ * @file kalman_oosm.h
+ * @brief Timestamped Kalman filter accepting out-of-sequence measurements
+ */
+
+#ifndef VT_LINALG_KALMAN_OOSM_H
+#define VT_LINALG_KALMAN_OOSM_H
+
+#include "circular_buffer.h"
+#include "kalman.h"
+#include "kalman_lut.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Timestamped Kalman filter that accepts measurements arriving late.\n
+     * Every step is kept in a ring of History entries holding its time, input, measurement,
+     * discrete model (F, Q) and posterior (x, P). Model is called as model(dt) and returns
+     * a discrete_model_t, e.g. a vdt<Degree>::generate_model() or van_loan() wrapper.\n
+     * A late measurement is handled either by rollback, restoring the last step before it and
+     * replaying the newer steps with their cached models, or by the Bar-Shalom A1 retrodiction,
+     * which updates the current posterior directly and is exact when the measurement falls within
+     * the latest interval. Retrodiction falls back to rollback for older measurements and for a
+     * second late measurement in the same interval.\n
+     * Inputs act as impulses x <- F x + B u at the time of their step, so splitting an interval
+     * keeps the input at the later step.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam History Number of steps kept for late measurements
+     * @tparam Model Callable returning discrete_model_t<N> for a time step dt
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension, size_t History,
+             typename Model = discrete_model_t<StateVectorDimension> (*)(const real_t &)>
+    class oosm_kalman_filter_t {
+    public:
+        static_assert(History > 1, "History must hold at least two steps.");
+
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        struct step_t {
+            real_t t;                  // time of the step
+            numeric_vector<M_> z;      // measurement, if measured
+            numeric_vector<L_> u;      // input applied at t
+            numeric_matrix<N_, N_> F;  // state-transition model from the previous step
+            numeric_matrix<N_, N_> Q;  // covariance of the process noise from the previous step
+            numeric_vector<N_> x;      // posterior state
+            numeric_matrix<N_, N_> P;  // posterior covariance
+            bool measured;             // whether z is used
+            bool stale;                // posterior not recomputed since a retrodiction
+        };
+
+        // Innovation terms of the latest step, used by retrodiction
+        struct retrodiction_t {
+            numeric_matrix<N_, N_> P_prior;    // prior covariance P_k|k-1
+            numeric_vector<N_> Ht_Sinv_nu;     // H^T S^-1 (z - H x_k|k-1)
+            numeric_matrix<N_, N_> Ht_Sinv_H;  // H^T S^-1 H
+            bool valid;                        // whether the terms describe the latest posterior
+        };
+
+    protected:
+        Model model_;                                  // discrete model generator
+        const numeric_matrix<N_, L_> &B_;              // control-input model
+        const numeric_matrix<M_, N_> &H_;              // measurement model
+        const numeric_matrix<M_, M_> &R_;              // covariance of the measurement noise
+        circular_buffer_static_t<step_t, History> w_;  // step history, front is the oldest
+        retrodiction_t last_;                          // innovation terms of w_.back()
+        bool retrodiction_;                            // handle late measurements by retrodiction
+
+    public:
+        /**
+         * Out-of-sequence Kalman filter constructor
+         *
+         * @param model discrete model generator, called as model(dt)
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         * @param P_0 initial state covariance
+         * @param t_0 initial time
+         */
+        oosm_kalman_filter_t(
+                Model model,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<M_, N_> &H_matrix,
+                const numeric_matrix<M_, M_> &R_matrix,
+                const numeric_vector<N_> &x_0,
+                const numeric_matrix<N_, N_> &P_0,
+                const real_t &t_0 = 0.)
+            : model_(model), B_{B_matrix}, H_{H_matrix}, R_{R_matrix}, retrodiction_{false} {
+            w_.push(step_t{t_0, {}, {}, numeric_matrix<N_, N_>::identity(), {}, x_0, P_0, false, false});
+            last_.P_prior = P_0;
+            last_.valid   = true;
+        }
+
+        /**
+         * Time update to t without a measurement, recorded as a step
+         *
+         * @param t Time, not earlier than the latest step
+         * @param u control input vector
+         * @return Whether t was in sequence
+         */
+        bool predict(const real_t &t, const numeric_vector<L_> &u = {}) {
+            if (t < w_.back().t) return false;
+            append(step_t{t, {}, u, {}, {}, {}, {}, false, false});
+            return true;
+        }
+
+        /**
+         * Measurement update at time t, which may be earlier than the latest step
+         *
+         * @param t Time of the measurement
+         * @param z Measurement vector
+         * @param u control input vector applied at t
+         * @return Whether the measurement was used, false if older than the kept history
+         */
+        bool update(const real_t &t, const numeric_vector<M_> &z, const numeric_vector<L_> &u = {}) {
+            if (t >= w_.back().t) {
+                append(step_t{t, z, u, {}, {}, {}, {}, true, false});
+                return true;
+            }
+
+            // Latest step not after t
+            size_t q = w_.size() - 1;
+            while (q > 0 && w_[q].t > t) --q;
+            if (w_[q].t > t) return false;
+
+            step_t late{t, z, u, {}, {}, {}, {}, true, false};
+            if (retrodiction_ && last_.valid && q == w_.size() - 2) {
+                retrodict(late, q);
+                return true;
+            }
+            return rollback(late, q);
+        }
+
+        /**
+         * Selects retrodiction (or rollback) for late measurements in the latest interval
+         *
+         * @param retrodiction
+         */
+        oosm_kalman_filter_t &set_retrodiction(bool retrodiction) {
+            retrodiction_ = retrodiction;
+            return *this;
+        }
+
+        [[nodiscard]] constexpr bool is_retrodiction() const { return retrodiction_; }
+
+        const numeric_vector<N_> &state_vector() const { return w_.back().x; }
+
+        const numeric_matrix<N_, N_> &covariance() const { return w_.back().P; }
+
+        /**
+         * Time of the latest step
+         *
+         * @return Time
+         */
+        const real_t &time() const { return w_.back().t; }
+
+        /**
+         * Time of the oldest step, measurements before it are rejected
+         *
+         * @return Time
+         */
+        const real_t &horizon() const { return w_.front().t; }
+
+        [[nodiscard]] constexpr size_t size() const { return w_.size(); }
+
+        [[nodiscard]] static constexpr size_t capacity() { return History; }
+
+    private:
+        /**
+         * Propagates prev to step s with the cached model of s, then applies its measurement.
+         * Leaves the innovation terms of s in last_.
+         */
+        void propagate(step_t &s, const step_t &prev) {
+            s.x = vt::move(s.F * prev.x + B_ * s.u);
+            s.P = vt::move(detail::covariance_predict(s.F, prev.P, s.Q));
+
+            last_.P_prior = s.P;
+            last_.valid   = true;
+            if (!s.measured) {
+                last_.Ht_Sinv_nu = numeric_vector<N_>();
+                last_.Ht_Sinv_H  = numeric_matrix<N_, N_>();
+                s.stale          = false;
+                return;
+            }
+
+            // Information terms H^T S^-1 y and H^T S^-1 H kept for retrodiction
+            const numeric_matrix<N_, M_> P_H_t  = vt::move(s.P.matmul_T(H_));
+            const numeric_matrix<M_, M_> L_S    = vt::move((H_ * P_H_t + R_).cholesky());
+            const numeric_matrix<M_, N_> Sinv_H = vt::move(L_S.cholesky_solve(H_));
+            const numeric_vector<M_> y_         = vt::move(s.z - H_ * s.x);
+
+            last_.Ht_Sinv_nu = vt::move(Sinv_H.transpose() * y_);
+            last_.Ht_Sinv_H  = vt::move(H_.transpose() * Sinv_H);
+            detail::cholesky_update(s.x, s.P, P_H_t, L_S, y_);
+            s.stale = false;
+        }
+
+        void set_model(step_t &s, const real_t &dt) {
+            discrete_model_t<N_> model = model_(dt);
+            s.F                        = vt::move(model.F);
+            s.Q                        = vt::move(model.Q);
+        }
+
+        void append(step_t &&s) {
+            set_model(s, s.t - w_.back().t);
+            propagate(s, w_.back());
+            w_.push_overwrite(vt::move(s));
+        }
+
+        /**
+         * Inserts s after step q, dropping the oldest step when full.
+         * When q itself is the dropped step, s becomes the oldest one.
+         */
+        void insert_after(step_t &&s, size_t q) {
+            const size_t popped_ = w_.full() ? 1 : 0;
+            const size_t slot_   = q + 1 - popped_;
+            if (popped_) w_.pop();
+            w_.push(vt::move(s));
+            for (size_t j = w_.size() - 1; j > slot_; --j) vt::swap(w_[j], w_[j - 1]);
+        }
+
+        /**
+         * Restores the last fresh posterior not after the late step, then replays the newer steps.
+         * Only the step right after the late one needs a new model.
+         */
+        bool rollback(step_t &late, size_t q) {
+            size_t p = q;
+            while (p > 0 && w_[p].stale) --p;
+            if (w_[p].stale) return false;
+
+            for (size_t j = p + 1; j <= q; ++j) propagate(w_[j], w_[j - 1]);
+            set_model(late, late.t - w_[q].t);
+            propagate(late, w_[q]);
+
+            set_model(w_[q + 1], w_[q + 1].t - late.t);
+            propagate(w_[q + 1], late);
+            for (size_t j = q + 2; j < w_.size(); ++j) propagate(w_[j], w_[j - 1]);
+
+            insert_after(vt::move(late), q);
+            return true;
+        }
+
+        /**
+         * Bar-Shalom A1 update of the latest posterior with a measurement at tau in the latest interval (t_q, t_k]:\n
+         * x_tau|k = F_tau,k (x_k|k - B u_k - Q_k,tau H^T S^-1 nu_k),\n
+         * P_vv = Q_k,tau - Q_k,tau H^T S^-1 H Q_k,tau, P_xv = Q_k,tau - P_k|k-1 H^T S^-1 H Q_k,tau,\n
+         * P_tau|k = F_tau,k (P_k|k + P_vv - P_xv - P_xv^T) F_tau,k^T, P_xz = (P_k|k - P_xv) F_tau,k^T H^T,\n
+         * x_k|tau = x_k|k + P_xz S_tau^-1 (z - H x_tau|k), P_k|tau = P_k|k - P_xz S_tau^-1 P_xz^T.
+         */
+        void retrodict(step_t &late, size_t q) {
+            step_t &k_ = w_.back();
+
+            set_model(late, late.t - w_[q].t);
+            const discrete_model_t<N_> k_tau      = model_(k_.t - late.t);
+            const numeric_matrix<N_, N_> &F_k_tau = k_tau.F;
+            const numeric_matrix<N_, N_> &Q_k_tau = k_tau.Q;
+            const numeric_matrix<N_, N_> F_tau_k  = vt::move(F_k_tau.solve(numeric_matrix<N_, N_>::identity()));
+
+            const numeric_vector<N_> x_tau = vt::move(F_tau_k * (k_.x - B_ * k_.u - Q_k_tau * last_.Ht_Sinv_nu) + B_ * late.u);
+
+            const numeric_matrix<N_, N_> HSH_Q   = vt::move(last_.Ht_Sinv_H * Q_k_tau);
+            const numeric_matrix<N_, N_> P_vv    = vt::move(Q_k_tau - Q_k_tau * HSH_Q);
+            const numeric_matrix<N_, N_> P_xv    = vt::move(Q_k_tau - last_.P_prior * HSH_Q);
+            const numeric_matrix<N_, N_> P_tau   = vt::move(F_tau_k * (k_.P + P_vv - P_xv - P_xv.transpose()).matmul_T(F_tau_k));
+            const numeric_matrix<N_, M_> P_xz    = vt::move((k_.P - P_xv).matmul_T(H_ * F_tau_k));
+            const numeric_matrix<M_, M_> S_tau   = vt::move(H_ * P_tau.matmul_T(H_) + R_);
+            const numeric_matrix<M_, N_> W_t     = vt::move(S_tau.cholesky().cholesky_solve(P_xz.transpose()));
+
+            k_.x += F_k_tau * (B_ * late.u) + W_t.transpose() * (late.z - H_ * x_tau);
+            k_.P -= P_xz * W_t;
+
+            // Late step has no posterior of its own until a rollback replays it
+            k_.F        = k_tau.F;
+            k_.Q        = k_tau.Q;
+            late.stale  = true;
+            last_.valid = false;
+            insert_after(vt::move(late), q);
+        }
+    };
+
+    /**
+     * Creates out-of-sequence Kalman filter from any discrete model generator, e.g. a lambda.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam History Number of steps kept for late measurements
+     * @tparam Model
+     * @return Out-of-sequence Kalman filter
+     */
+    template<size_t N, size_t M, size_t L, size_t History, typename Model>
+    oosm_kalman_filter_t<N, M, L, History, Model>
+    make_oosm_kalman_filter(Model model,
+                            const numeric_matrix<N, L> &B_matrix,
+                            const numeric_matrix<M, N> &H_matrix,
+                            const numeric_matrix<M, M> &R_matrix,
+                            const numeric_vector<N> &x_0,
+                            const numeric_matrix<N, N> &P_0,
+                            const real_t &t_0 = 0.) {
+        return {model, B_matrix, H_matrix, R_matrix, x_0, P_0, t_0};
+    }
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_OOSM_H
@@ -0,0 +1,329 @@
+/**
+ * @file kalman_smoother.h
+ * @brief Kalman smoothers over recorded filter runs
+ */
+
+#ifndef VT_LINALG_KALMAN_SMOOTHER_H
+#define VT_LINALG_KALMAN_SMOOTHER_H
+
+#include "circular_buffer.h"
+#include "kalman.h"
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    namespace detail {
+        /**
+         * Packs the upper triangle of a symmetric matrix row by row.
+         *
+         * @tparam N
+         * @param P Symmetric matrix
+         * @param packed Output of N (N + 1) / 2 entries
+         */
+        template<size_t N>
+        void pack_symmetric(const numeric_matrix<N, N> &P, numeric_vector<N * (N + 1) / 2> &packed) {
+            size_t k = 0;
+            for (size_t i = 0; i < N; ++i)
+                for (size_t j = i; j < N; ++j) packed[k++] = P[i][j];
+        }
+
+        /**
+         * Unpacks a symmetric matrix stored by pack_symmetric().
+         *
+         * @tparam N
+         * @param packed Packed upper triangle
+         * @return Symmetric matrix
+         */
+        template<size_t N>
+        numeric_matrix<N, N> unpack_symmetric(const numeric_vector<N * (N + 1) / 2> &packed) {
+            numeric_matrix<N, N> P;
+            size_t k = 0;
+            for (size_t i = 0; i < N; ++i)
+                for (size_t j = i; j < N; ++j) P[i][j] = P[j][i] = packed[k++];
+            return P;
+        }
+    }  // namespace detail
+
+    /**
+     * Rauch-Tung-Striebel fixed-interval smoother.\n
+     * Records the prior, posterior and transition of every filter step into fixed storage,
+     * with covariances packed as upper triangles, then smooths backward in place:
+     * C_k = P_k|k F_k+1^T P_k+1|k^-1, x_k = x_k|k + C_k (x_k+1 - x_k+1|k),
+     * P_k = P_k|k + C_k (P_k+1 - P_k+1|k) C_k^T, with P_k+1|k^-1 applied by Cholesky solves.\n
+     * Storage is a member array of Capacity steps, so large capacities should have static storage duration.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam Capacity Maximum number of recorded steps
+     */
+    template<size_t StateVectorDimension, size_t Capacity>
+    class rts_smoother_t {
+    private:
+        static constexpr size_t N_ = StateVectorDimension;  // Alias
+        static constexpr size_t S_ = N_ * (N_ + 1) / 2;     // Packed symmetric size
+
+        struct step_t {
+            numeric_vector<N_> x_prior;   // predicted state x_k|k-1
+            numeric_vector<S_> P_prior;   // predicted covariance P_k|k-1, packed
+            numeric_vector<N_> x_post;    // filtered state x_k|k, smoothed state after smooth()
+            numeric_vector<S_> P_post;    // filtered covariance P_k|k, smoothed covariance after smooth()
+            numeric_matrix<N_, N_> F;     // transition from step k-1 to k
+        };
+
+        step_t steps_[Capacity];
+        size_t size_    = 0;
+        bool has_prior_ = false;
+        bool is_smooth_ = false;
+
+    public:
+        rts_smoother_t() = default;
+
+        /**
+         * Records the predicted state, covariance and the transition that produced them.
+         *
+         * @param x_prior Predicted state
+         * @param P_prior Predicted covariance
+         * @param F_matrix Transition from the previous step
+         * @return Whether there was room to record the step
+         */
+        bool push_prior(const numeric_vector<N_> &x_prior,
+                        const numeric_matrix<N_, N_> &P_prior,
+                        const numeric_matrix<N_, N_> &F_matrix) {
+            if (size_ >= Capacity) return false;
+            step_t &step_ = steps_[size_];
+            step_.x_prior = x_prior;
+            detail::pack_symmetric(P_prior, step_.P_prior);
+            step_.F    = F_matrix;
+            has_prior_ = true;
+            return true;
+        }
+
+        /**
+         * Records the filtered state and covariance of the step opened by push_prior().
+         *
+         * @param x_post Filtered state
+         * @param P_post Filtered covariance
+         * @return Whether the step was recorded
+         */
+        bool push_posterior(const numeric_vector<N_> &x_post, const numeric_matrix<N_, N_> &P_post) {
+            if (!has_prior_ || size_ >= Capacity) return false;
+            step_t &step_ = steps_[size_++];
+            step_.x_post  = x_post;
+            detail::pack_symmetric(P_post, step_.P_post);
+            has_prior_ = false;
+            is_smooth_ = false;
+            return true;
+        }
+
+        /**
+         * Runs one predict-update cycle of the filter and records it.\n
+         * Filter must provide predict(u), update(z), state_vector, covariance() and transition().
+         *
+         * @tparam Filter
+         * @tparam Measurement
+         * @tparam Control
+         * @param filter Filter to advance
+         * @param z Measurement vector
+         * @param u control input vector
+         * @return Whether there was room to record the step
+         */
+        template<typename Filter, typename Measurement, typename Control>
+        bool record(Filter &filter, const Measurement &z, const Control &u) {
+            filter.predict(u);
+            if (!push_prior(filter.state_vector, filter.covariance(), filter.transition())) return false;
+            filter.update(z);
+            return push_posterior(filter.state_vector, filter.covariance());
+        }
+
+        template<typename Filter, typename Measurement>
+        bool record(Filter &filter, const Measurement &z) {
+            filter.predict();
+            if (!push_prior(filter.state_vector, filter.covariance(), filter.transition())) return false;
+            filter.update(z);
+            return push_posterior(filter.state_vector, filter.covariance());
+        }
+
+        /**
+         * Runs the backward pass, replacing filtered estimates by smoothed ones.
+         *
+         * @return Reference to this smoother
+         */
+        rts_smoother_t &smooth() {
+            if (is_smooth_ || size_ < 2) {
+                is_smooth_ = true;
+                return *this;
+            }
+
+            numeric_matrix<N_, N_> P_next_s = detail::unpack_symmetric<N_>(steps_[size_ - 1].P_post);
+            for (size_t k = size_ - 1; k-- > 0;) {
+                step_t &step_                         = steps_[k];
+                const step_t &next_                   = steps_[k + 1];
+                const numeric_matrix<N_, N_> P_f      = detail::unpack_symmetric<N_>(step_.P_post);
+                const numeric_matrix<N_, N_> P_p_next = detail::unpack_symmetric<N_>(next_.P_prior);
+
+                // C^T = P_k+1|k^-1 F_k+1 P_k|k
+                const numeric_matrix<N_, N_> C_t = vt::move(P_p_next.cholesky().cholesky_solve(next_.F * P_f));
+                const numeric_matrix<N_, N_> C   = C_t.transpose();
+
+                step_.x_post += C * (next_.x_post - next_.x_prior);
+                numeric_matrix<N_, N_> P_s = vt::move(P_f + C * (P_next_s - P_p_next) * C_t);
+                detail::pack_symmetric(P_s, step_.P_post);
+                P_next_s = vt::move(P_s);
+            }
+            is_smooth_ = true;
+            return *this;
+        }
+
+        /**
+         * Discards all recorded steps.
+         */
+        void clear() {
+            size_      = 0;
+            has_prior_ = false;
+            is_smooth_ = false;
+        }
+
+        /**
+         * State of step k, smoothed once smooth() has run
+         *
+         * @param k Step index
+         * @return State vector
+         */
+        const numeric_vector<N_> &state(size_t k) const { return steps_[k].x_post; }
+
+        /**
+         * Covariance of step k, smoothed once smooth() has run
+         *
+         * @param k Step index
+         * @return State covariance
+         */
+        numeric_matrix<N_, N_> covariance(size_t k) const { return detail::unpack_symmetric<N_>(steps_[k].P_post); }
+
+        [[nodiscard]] constexpr size_t size() const { return size_; }
+
+        [[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+
+        [[nodiscard]] constexpr bool is_smooth() const { return is_smooth_; }
+    };
+
+    /**
+     * Fixed-lag smoother around a Kalman filter.\n
+     * Keeps the last Lag + 1 priors and posteriors with the RTS gains linking them in a circular buffer.
+     * Each gain C_k = P_k|k F^T P_k+1|k^-1 is solved once when step k + 1 is predicted, so the
+     * backward pass producing x_k-Lag|k costs O(Lag N^2) per step without heap allocation.
+     * Call predict() before each update(), or use operator<<.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Lag Smoothing lag in steps
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension, size_t Lag>
+    class fixed_lag_smoother_t {
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+
+        struct step_t {
+            numeric_vector<N_> x_prior;  // predicted state x_k|k-1
+            numeric_vector<N_> x_post;   // filtered state x_k|k
+            numeric_matrix<N_, N_> C;    // RTS gain to the next step
+        };
+
+    protected:
+        kalman_filter_t<N_, M_, L_> kf_;                  // underlying filter
+        circular_buffer_static_t<step_t, Lag + 1> window_;  // last Lag + 1 steps, front is the oldest
+        numeric_vector<N_> x_prior_;                       // prior of the step in progress
+        numeric_vector<N_> x_smooth_;                      // smoothed estimate of the oldest step in the window
+
+    public:
+        /**
+         * Fixed-lag smoother constructor, arguments as kalman_filter_t
+         *
+         * @param F_matrix state-transition model
+         * @param B_matrix control-input model
+         * @param H_matrix measurement model
+         * @param Q_matrix covariance of the process noise
+         * @param R_matrix covariance of the measurement noise
+         * @param x_0 initial state vector
+         */
+        fixed_lag_smoother_t(
+                const numeric_matrix<N_, N_> &F_matrix,
+                const numeric_matrix<N_, L_> &B_matrix,
+                const numeric_matrix<M_, N_> &H_matrix,
+                const numeric_matrix<N_, N_> &Q_matrix,
+                const numeric_matrix<M_, M_> &R_matrix,
+                const numeric_vector<N_> &x_0)
+            : kf_(F_matrix, B_matrix, H_matrix, Q_matrix, R_matrix, x_0),
+              x_prior_{x_0}, x_smooth_{x_0} {}
+
+        /**
+         * Prediction, also solves the RTS gain of the latest recorded step
+         *
+         * @param u control input vector
+         */
+        fixed_lag_smoother_t &predict(const numeric_vector<L_> &u = {}) {
+            const numeric_matrix<N_, N_> P_post = kf_.covariance();
+            kf_.predict(u);
+            x_prior_ = kf_.state_vector;
+            if (!window_.empty()) {
+                // C^T = P_k+1|k^-1 F P_k|k
+                window_.back().C = kf_.covariance().cholesky().cholesky_solve(kf_.transition() * P_post).transpose();
+            }
+            return *this;
+        }
+
+        /**
+         * Update, then smooths back to the oldest step in the window
+         *
+         * @param z Measurement vector
+         */
+        fixed_lag_smoother_t &update(const numeric_vector<M_> &z) {
+            kf_.update(z);
+            window_.push_overwrite(step_t{x_prior_, kf_.state_vector, numeric_matrix<N_, N_>()});
+
+            x_smooth_ = window_.back().x_post;
+            for (size_t j = window_.size() - 1; j-- > 0;) {
+                const step_t &step_ = window_[j];
+                x_smooth_           = vt::move(step_.x_post + step_.C * (x_smooth_ - window_[j + 1].x_prior));
+            }
+            return *this;
+        }
+
+        fixed_lag_smoother_t &operator<<(const numeric_vector<M_> &z) {
+            return predict().update(z);
+        }
+
+        template<typename... Ts>
+        fixed_lag_smoother_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+        /**
+         * Smoothed estimate of the step Lag steps behind the latest update,
+         * or of the first step while fewer than Lag + 1 steps have been processed
+         *
+         * @return Smoothed state vector
+         */
+        const numeric_vector<N_> &smoothed_state() const { return x_smooth_; }
+
+        /**
+         * Whether the window is full and smoothed_state() lags by exactly Lag steps
+         *
+         * @return
+         */
+        [[nodiscard]] constexpr bool ready() const { return window_.full(); }
+
+        /**
+         * Filtered state of the latest step
+         *
+         * @return Filtered state vector
+         */
+        const numeric_vector<N_> &state_vector() const { return kf_.state_vector; }
+
+        const kalman_filter_t<N_, M_, L_> &filter() const { return kf_; }
+
+        [[nodiscard]] static constexpr size_t lag() { return Lag; }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_KALMAN_SMOOTHER_H
@@ -0,0 +1,162 @@
+/**
+ * @file kronecker.h
+ * @brief Kronecker product tools for structured numeric matrices
+ */
+
+#ifndef VT_LINALG_KRONECKER_H
+#define VT_LINALG_KRONECKER_H
+
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "standard_utility.h"
+
+namespace vt {
+    namespace impl {
+        /**
+         * Kronecker product A (x) B kept in factored form.
+         * Entry (i * R2 + k, j * C2 + l) equals A(i, j) * B(k, l).\n
+         * Applying it to a vector uses (A (x) B) vec(X) = vec(A X B^T) with X stored row-major,
+         * which costs O(R1 C1 R2 + C1 C2 R2) instead of O(R1 R2 C1 C2).
+         *
+         * @tparam T data type
+         * @tparam R1 row dimension of A
+         * @tparam C1 column dimension of A
+         * @tparam R2 row dimension of B
+         * @tparam C2 column dimension of B
+         */
+        template<typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+        class numeric_matrix_kron_t {
+        private:
+            numeric_matrix_static_t<T, R1, C1> a_;
+            numeric_matrix_static_t<T, R2, C2> b_;
+
+        public:
+            constexpr numeric_matrix_kron_t(const numeric_matrix_static_t<T, R1, C1> &a,
+                                            const numeric_matrix_static_t<T, R2, C2> &b)
+                : a_(a), b_(b) {}
+
+            constexpr numeric_matrix_kron_t(const numeric_matrix_kron_t &) = default;
+
+            constexpr numeric_matrix_kron_t(numeric_matrix_kron_t &&) noexcept = default;
+
+            constexpr const numeric_matrix_static_t<T, R1, C1> &a() const { return a_; }
+
+            constexpr const numeric_matrix_static_t<T, R2, C2> &b() const { return b_; }
+
+            constexpr T at(size_t r_index, size_t c_index) const {
+                return a_[r_index / R2][c_index / C2] * b_[r_index % R2][c_index % C2];
+            }
+
+            constexpr T operator()(size_t r_index, size_t c_index) const { return at(r_index, c_index); }
+
+            /**
+             * Transform input vector without forming the full product.
+             *
+             * @param x Input vector
+             * @return (A (x) B) x
+             */
+            numeric_vector_static_t<T, R1 * R2> operator*(const numeric_vector_static_t<T, C1 * C2> &x) const {
+                // X B^T, X is C1 x C2 row-major
+                numeric_matrix_static_t<T, C1, R2> XBt;
+                for (size_t j = 0; j < C1; ++j)
+                    for (size_t k = 0; k < R2; ++k) {
+                        T acc = 0;
+                        for (size_t l = 0; l < C2; ++l) acc += x[j * C2 + l] * b_[k][l];
+                        XBt[j][k] = acc;
+                    }
+
+                numeric_vector_static_t<T, R1 * R2> y;
+                for (size_t i = 0; i < R1; ++i)
+                    for (size_t j = 0; j < C1; ++j) {
+                        const T aij = a_[i][j];
+                        for (size_t k = 0; k < R2; ++k) y[i * R2 + k] += aij * XBt[j][k];
+                    }
+                return y;
+            }
+
+            /**
+             * Forms the full product matrix.
+             *
+             * @return A (x) B as dense matrix
+             */
+            numeric_matrix_static_t<T, R1 * R2, C1 * C2> dense() const {
+                numeric_matrix_static_t<T, R1 * R2, C1 * C2> result;
+                for (size_t i = 0; i < R1; ++i)
+                    for (size_t j = 0; j < C1; ++j)
+                        for (size_t k = 0; k < R2; ++k)
+                            for (size_t l = 0; l < C2; ++l)
+                                result[i * R2 + k][j * C2 + l] = a_[i][j] * b_[k][l];
+                return result;
+            }
+
+            [[nodiscard]] constexpr size_t r() const { return R1 * R2; }
+
+            [[nodiscard]] constexpr size_t c() const { return C1 * C2; }
+        };
+    }  // namespace impl
+
+    /**
+     * Computes dense Kronecker product A (x) B.
+     *
+     * @tparam T
+     * @tparam R1
+     * @tparam C1
+     * @tparam R2
+     * @tparam C2
+     * @param A Left factor
+     * @param B Right factor
+     * @return A (x) B
+     */
+    template<typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+    impl::numeric_matrix_static_t<T, R1 * R2, C1 * C2> kron(const impl::numeric_matrix_static_t<T, R1, C1> &A,
+                                                            const impl::numeric_matrix_static_t<T, R2, C2> &B) {
+        return impl::numeric_matrix_kron_t<T, R1, C1, R2, C2>(A, B).dense();
+    }
+
+    /**
+     * Creates factored Kronecker product A (x) B.
+     *
+     * @tparam T
+     * @tparam R1
+     * @tparam C1
+     * @tparam R2
+     * @tparam C2
+     * @param A Left factor
+     * @param B Right factor
+     * @return A (x) B in factored form
+     */
+    template<typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+    constexpr impl::numeric_matrix_kron_t<T, R1, C1, R2, C2> make_kron(const impl::numeric_matrix_static_t<T, R1, C1> &A,
+                                                                       const impl::numeric_matrix_static_t<T, R2, C2> &B) {
+        return impl::numeric_matrix_kron_t<T, R1, C1, R2, C2>(A, B);
+    }
+
+    /**
+     * Checks whether M = M1 (x) I_Axes, i.e. Axes identical blocks interleaved by component,
+     * and extracts M1 if so.
+     *
+     * @tparam Axes Number of decoupled axes
+     * @tparam T
+     * @tparam R Row dimension of M1
+     * @tparam C Column dimension of M1
+     * @param M Interleaved matrix
+     * @param M1 Per-axis factor output
+     * @param threshold Equality threshold
+     * @return Whether M is separable into decoupled axes
+     */
+    template<size_t Axes, typename T, size_t R, size_t C>
+    bool kron_identity_factor(const impl::numeric_matrix_static_t<T, R * Axes, C * Axes> &M,
+                              impl::numeric_matrix_static_t<T, R, C> &M1,
+                              real_t threshold = 1e-12) {
+        for (size_t i = 0; i < R; ++i)
+            for (size_t j = 0; j < C; ++j) M1[i][j] = M[i * Axes][j * Axes];
+        for (size_t r = 0; r < R * Axes; ++r)
+            for (size_t c = 0; c < C * Axes; ++c) {
+                const T expected = (r % Axes == c % Axes) ? M1[r / Axes][c / Axes] : T();
+                if (abs(M[r][c] - expected) > threshold) return false;
+            }
+        return true;
+    }
+}  // namespace vt
+
+#endif  //VT_LINALG_KRONECKER_H
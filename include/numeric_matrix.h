@@ -18,6 +18,12 @@ namespace vt {
         template<typename T, size_t OSize>
         class numeric_matrix_static_lu_t;
 
+        template<typename T, size_t OSize>
+        class numeric_matrix_static_eigen_t;
+
+        template<typename T, size_t Row, size_t Col>
+        class numeric_matrix_static_svd_t;
+
         /**
          * Numeric matrix template class where the dimension must be known at compile-time
          * and can't be changed by any ways during runtime to prevent unexpected
@@ -559,6 +565,115 @@ namespace vt {
              */
             constexpr numeric_matrix_static_t inverse() const { return inv(); }
 
+            /**
+             * Solves AX = B for X using Gaussian elimination with partial pivoting.\n
+             * If this matrix is not square, the compile-time error is thrown.
+             *
+             * A pivot is singular when it is at most epsilon * Order * max |a_ij|, so the test does not depend
+             * on the scale of the entries. If this matrix is singular, every entry of the solution is NaN,
+             * which propagates to whatever is computed from it instead of passing for a valid result.
+             *
+             * @tparam OCol
+             * @param B Right-hand side
+             * @return Solution X
+             */
+            template<size_t OCol>
+            numeric_matrix_static_t<T, Row, OCol> solve(const numeric_matrix_static_t<T, Row, OCol> &B) const {
+                static_assert(static_is_a_square_matrix(), "Can only solve with a square matrix.");
+                numeric_matrix_static_t a(*this);
+                numeric_matrix_static_t<T, Row, OCol> x(B);
+
+                T scale = 0;
+                for (size_t i = 0; i < Order; ++i)
+                    for (size_t j = 0; j < Order; ++j) scale = max(scale, abs(a[i][j]));
+                const T tolerance = epsilon<T>() * static_cast<T>(Order) * scale;
+
+                for (size_t k = 0; k < Order; ++k) {
+                    size_t pivot = k;
+                    for (size_t i = k + 1; i < Order; ++i)
+                        if (abs(a[i][k]) > abs(a[pivot][k])) pivot = i;
+                    if (abs(a[pivot][k]) <= tolerance) return numeric_matrix_static_t<T, Row, OCol>(static_cast<T>(NAN));
+                    if (pivot != k) {
+                        a[pivot].swap(a[k]);
+                        x[pivot].swap(x[k]);
+                    }
+                    const T inv_pivot = 1 / a[k][k];
+                    for (size_t i = k + 1; i < Order; ++i) {
+                        const T factor = a[i][k] * inv_pivot;
+                        if (factor == 0) continue;
+                        for (size_t j = k; j < Order; ++j) a[i][j] -= factor * a[k][j];
+                        for (size_t j = 0; j < OCol; ++j) x[i][j] -= factor * x[k][j];
+                    }
+                }
+                for (size_t k = Order; k-- > 0;) {
+                    for (size_t j = 0; j < OCol; ++j) {
+                        T acc = x[k][j];
+                        for (size_t i = k + 1; i < Order; ++i) acc -= a[k][i] * x[i][j];
+                        x[k][j] = acc / a[k][k];
+                    }
+                }
+                return x;
+            }
+
+            /**
+             * Solves Ax = b for x using Gaussian elimination with partial pivoting.\n
+             * If this matrix is not square, the compile-time error is thrown.
+             *
+             * @param b Right-hand side
+             * @return Solution x
+             */
+            numeric_vector_static_t<T, Row> solve(const numeric_vector_static_t<T, Row> &b) const {
+                numeric_matrix_static_t<T, Row, 1> B;
+                for (size_t i = 0; i < Row; ++i) B[i][0] = b[i];
+                return solve(B).col(0);
+            }
+
+            /**
+             * Finds matrix exponential e^A of this matrix using scaling and squaring
+             * with the (6, 6) Pade approximant.\n
+             * If this matrix is not square, the compile-time error is thrown.
+             *
+             * @return Matrix exponential
+             */
+            numeric_matrix_static_t expm() const {
+                static_assert(static_is_a_square_matrix(), "Can only find exponential of a square matrix.");
+                constexpr size_t q = 6;
+
+                T norm = 0;
+                for (size_t i = 0; i < Row; ++i) {
+                    T acc = 0;
+                    for (size_t j = 0; j < Col; ++j) acc += abs(vector_[i][j]);
+                    norm = max(norm, acc);
+                }
+
+                size_t squarings = 0;
+                T scale          = 1;
+                while (norm * scale > 0.5) {
+                    scale *= 0.5;
+                    ++squarings;
+                }
+
+                const numeric_matrix_static_t A = vt::move(operator*(scale));
+                numeric_matrix_static_t X(A);
+                T c                         = 0.5;
+                numeric_matrix_static_t num = vt::move(identity() + A * c);
+                numeric_matrix_static_t den = vt::move(identity() - A * c);
+
+                bool positive = true;
+                for (size_t k = 2; k <= q; ++k) {
+                    c = c * static_cast<T>(q - k + 1) / static_cast<T>(k * (2 * q - k + 1));
+                    X = vt::move(A * X);
+                    num += X * c;
+                    if (positive) den += X * c;
+                    else den -= X * c;
+                    positive = !positive;
+                }
+
+                numeric_matrix_static_t E = vt::move(den.solve(num));
+                for (size_t k = 0; k < squarings; ++k) E = vt::move(E * E);
+                return E;
+            }
+
             /**
              * Finds LU-decomposition of this matrix.\n
              * If this matrix is not square, the compile-time error is thrown.
@@ -587,6 +702,220 @@ namespace vt {
                 return {lower, upper};
             }
 
+            /**
+             * Finds Cholesky factor L of this symmetric matrix such that L * L^T equals this matrix.\n
+             * Columns with non-positive pivots are set to zero so semi-definite matrices are accepted.
+             * If this matrix is not square, the compile-time error is thrown.
+             *
+             * @return Lower-triangular Cholesky factor
+             */
+            numeric_matrix_static_t<T, Order, Order> cholesky() const {
+                static_assert(static_is_a_square_matrix(), "Can only find Cholesky factor of a square matrix.");
+                numeric_matrix_static_t<T, Order, Order> L;
+                for (size_t j = 0; j < Order; ++j) {
+                    T d = vector_[j][j];
+                    for (size_t k = 0; k < j; ++k) d -= L[j][k] * L[j][k];
+                    if (d <= epsilon<T>() * abs(vector_[j][j])) continue;
+                    L[j][j] = sqrt(d);
+                    for (size_t i = j + 1; i < Order; ++i) {
+                        T sum_ = vector_[i][j];
+                        for (size_t k = 0; k < j; ++k) sum_ -= L[i][k] * L[j][k];
+                        L[i][j] = sum_ / L[j][j];
+                    }
+                }
+                return L;
+            }
+
+            /**
+             * Finds lower-triangular L such that L * L^T equals A * A^T, where A is this matrix,
+             * using Householder reflections applied from the right (A * Theta = [L 0]).\n
+             * Diagonal entries of L are non-negative.
+             *
+             * @return Lower-triangular square root of A * A^T
+             */
+            numeric_matrix_static_t<T, Row, Row> tria() const {
+                numeric_matrix_static_t<T, Row, Col> W = *this;
+                for (size_t i = 0; i < Order; ++i) {
+                    T norm_ = 0;
+                    for (size_t j = i; j < Col; ++j) norm_ += W[i][j] * W[i][j];
+                    norm_ = sqrt(norm_);
+                    if (norm_ == 0) continue;
+
+                    const T alpha = W[i][i] > 0 ? -norm_ : norm_;
+                    numeric_vector_static_t<T, Col> v;
+                    for (size_t j = i; j < Col; ++j) v[j] = W[i][j];
+                    v[i] -= alpha;
+                    T v_norm_2 = 0;
+                    for (size_t j = i; j < Col; ++j) v_norm_2 += v[j] * v[j];
+                    if (v_norm_2 == 0) continue;
+
+                    for (size_t r = i; r < Row; ++r) {
+                        T d = 0;
+                        for (size_t j = i; j < Col; ++j) d += W[r][j] * v[j];
+                        d = 2 * d / v_norm_2;
+                        for (size_t j = i; j < Col; ++j) W[r][j] -= d * v[j];
+                    }
+                }
+
+                numeric_matrix_static_t<T, Row, Row> L;
+                for (size_t c = 0; c < Order; ++c) {
+                    const T sign_ = W[c][c] < 0 ? -1 : 1;
+                    for (size_t r = c; r < Row; ++r) L[r][c] = sign_ * W[r][c];
+                }
+                return L;
+            }
+
+            /**
+             * Solves L * x = b by forward substitution, where L is this lower-triangular matrix.\n
+             * Zero pivots yield zero entries.
+             *
+             * @param b Right-hand side vector
+             * @return Solution vector
+             */
+            numeric_vector_static_t<T, Order> solve_lower(const numeric_vector_static_t<T, Order> &b) const {
+                static_assert(static_is_a_square_matrix(), "Can only solve a square triangular system.");
+                numeric_vector_static_t<T, Order> x;
+                for (size_t i = 0; i < Order; ++i) {
+                    if (vector_[i][i] == 0) continue;
+                    T sum_ = b[i];
+                    for (size_t k = 0; k < i; ++k) sum_ -= vector_[i][k] * x[k];
+                    x[i] = sum_ / vector_[i][i];
+                }
+                return x;
+            }
+
+            /**
+             * Solves L^T * x = b by backward substitution, where L is this lower-triangular matrix.\n
+             * Zero pivots yield zero entries.
+             *
+             * @param b Right-hand side vector
+             * @return Solution vector
+             */
+            numeric_vector_static_t<T, Order> solve_lower_T(const numeric_vector_static_t<T, Order> &b) const {
+                static_assert(static_is_a_square_matrix(), "Can only solve a square triangular system.");
+                numeric_vector_static_t<T, Order> x;
+                for (size_t i = Order; i-- > 0;) {
+                    if (vector_[i][i] == 0) continue;
+                    T sum_ = b[i];
+                    for (size_t k = i + 1; k < Order; ++k) sum_ -= vector_[k][i] * x[k];
+                    x[i] = sum_ / vector_[i][i];
+                }
+                return x;
+            }
+
+            /**
+             * Solves (L * L^T) * X = B, where L is this lower-triangular Cholesky factor.
+             *
+             * @tparam OCol
+             * @param B Right-hand side matrix
+             * @return Solution matrix
+             */
+            template<size_t OCol>
+            numeric_matrix_static_t<T, Order, OCol> cholesky_solve(const numeric_matrix_static_t<T, Order, OCol> &B) const {
+                static_assert(static_is_a_square_matrix(), "Can only solve a square triangular system.");
+                numeric_matrix_static_t<T, Order, OCol> X;
+                for (size_t j = 0; j < OCol; ++j) {
+                    const numeric_vector_static_t<T, Order> x_j = solve_lower_T(solve_lower(B.col(j)));
+                    for (size_t i = 0; i < Order; ++i) X[i][j] = x_j[i];
+                }
+                return X;
+            }
+
+            /**
+             * Finds eigen-decomposition of this symmetric matrix using cyclic Jacobi rotations.\n
+             * The matrix is assumed to be symmetric. If this matrix is not square, the compile-time error is thrown.
+             *
+             * @param max_sweeps Maximum number of Jacobi sweeps over all off-diagonal entries
+             * @return Eigenvalues in ascending order and their orthonormal eigenvectors as columns
+             */
+            numeric_matrix_static_eigen_t<T, Order> eigen_symmetric(size_t max_sweeps = 32) const {
+                static_assert(static_is_a_square_matrix(), "Can only find eigen-decomposition of a square matrix.");
+                numeric_matrix_static_t a(*this);
+                numeric_matrix_static_t v = vt::move(identity());
+
+                for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+                    bool rotated = false;
+                    for (size_t p = 0; p < Order; ++p) {
+                        for (size_t q = p + 1; q < Order; ++q) {
+                            const T apq = a[p][q];
+                            if (abs(apq) <= epsilon<T>() * (abs(a[p][p]) + abs(a[q][q])) ||
+                                apq == 0) {
+                                a[p][q] = a[q][p] = 0;
+                                continue;
+                            }
+                            rotated = true;
+
+                            const T theta = (a[q][q] - a[p][p]) / (2 * apq);
+                            T t           = 1 / (abs(theta) + sqrt(theta * theta + 1));
+                            if (theta < 0) t = -t;
+                            const T c = 1 / sqrt(t * t + 1);
+                            const T s = t * c;
+
+                            a[p][p] -= t * apq;
+                            a[q][q] += t * apq;
+                            a[p][q] = a[q][p] = 0;
+
+                            for (size_t r = 0; r < Order; ++r) {
+                                if (r != p && r != q) {
+                                    const T arp = a[r][p];
+                                    const T arq = a[r][q];
+                                    a[r][p] = a[p][r] = c * arp - s * arq;
+                                    a[r][q] = a[q][r] = s * arp + c * arq;
+                                }
+                                const T vrp = v[r][p];
+                                const T vrq = v[r][q];
+                                v[r][p]     = c * vrp - s * vrq;
+                                v[r][q]     = s * vrp + c * vrq;
+                            }
+                        }
+                    }
+                    if (!rotated) break;
+                }
+
+                numeric_vector_static_t<T, Order> values = vt::move(a.diag());
+                for (size_t i = 0; i < Order; ++i) {
+                    size_t k = i;
+                    for (size_t j = i + 1; j < Order; ++j)
+                        if (values[j] < values[k]) k = j;
+                    if (k != i) {
+                        vt::swap(values[i], values[k]);
+                        for (size_t r = 0; r < Order; ++r) vt::swap(v[r][i], v[r][k]);
+                    }
+                }
+
+                return {values, v};
+            }
+
+            /**
+             * Finds thin singular value decomposition A = U * diag(s) * V^T of this matrix
+             * using one-sided (Hestenes) Jacobi rotations.
+             *
+             * @param max_sweeps Maximum number of Jacobi sweeps over all column pairs
+             * @return Singular values in descending order, U (Row x Order) and V (Col x Order)
+             */
+            numeric_matrix_static_svd_t<T, Row, Col> SVD(size_t max_sweeps = 32) const {
+                numeric_vector_static_t<T, Order> s;
+                if constexpr (Row >= Col) {
+                    numeric_matrix_static_t u(*this);
+                    numeric_matrix_static_t<T, Col, Col> v = vt::move(numeric_matrix_static_t<T, Col, Col>::identity());
+                    svd_one_sided_jacobi(u, v, s, max_sweeps);
+                    return {u, s, v};
+                } else {
+                    numeric_matrix_static_t<T, Col, Row> v = vt::move(transpose());
+                    numeric_matrix_static_t<T, Row, Row> u = vt::move(numeric_matrix_static_t<T, Row, Row>::identity());
+                    svd_one_sided_jacobi(v, u, s, max_sweeps);
+                    return {u, s, v};
+                }
+            }
+
+            /**
+             * Finds Moore-Penrose pseudo-inverse of this matrix from its SVD.\n
+             * Singular values below max(Row, Col) * eps * max(s) are treated as zero.
+             *
+             * @return Pseudo-inverse of this matrix
+             */
+            numeric_matrix_static_t<T, Col, Row> pinv() const { return SVD().pinv(); }
+
             /**
              * Finds Row-Reduced Echlon (RRE) form of this matrix.\n
              * If this matrix is not square, the compile-time error is thrown.
@@ -699,14 +1028,15 @@ namespace vt {
              * @tparam ORow
              * @tparam OCol
              * @param other Other matrix
+             * @param threshold Equality threshold
              * @return
              */
             template<size_t ORow, size_t OCol>
-            bool float_equals(const numeric_matrix_static_t<T, ORow, OCol> &other) const {
+            bool float_equals(const numeric_matrix_static_t<T, ORow, OCol> &other, real_t threshold = 1e-10) const {
                 if (this == &other) return true;
                 if (Row != ORow || Col != OCol) return false;
                 for (size_t i = 0; i < Row; ++i)
-                    if (!vector_[i].float_equals(other.vector_[i])) return false;
+                    if (!vector_[i].float_equals(other.vector_[i], threshold)) return false;
                 return true;
             }
 
@@ -784,6 +1114,18 @@ namespace vt {
              */
             [[nodiscard]] constexpr bool is_square() const { return Row == Col; }
 
+            /**
+             * Returns whether all off-diagonal entries are zero.
+             *
+             * @return
+             */
+            [[nodiscard]] constexpr bool is_diagonal() const {
+                for (size_t i = 0; i < Row; ++i)
+                    for (size_t j = 0; j < Col; ++j)
+                        if (i != j && vector_[i][j] != 0) return false;
+                return true;
+            }
+
             /**
              * Swaps entries with the other matrix.
              *
@@ -912,6 +1254,73 @@ namespace vt {
                 return mm_naive(C, A, B);
             }
 
+            /**
+             * One-sided Jacobi SVD kernel for a tall (or square) working matrix.\n
+             * On return, U holds the left singular vectors, V holds the right singular vectors,
+             * and s holds the singular values, all sorted in descending order.
+             */
+            template<size_t URow, size_t UCol>
+            static void svd_one_sided_jacobi(numeric_matrix_static_t<T, URow, UCol> &U,
+                                             numeric_matrix_static_t<T, UCol, UCol> &V,
+                                             numeric_vector_static_t<T, UCol> &s,
+                                             size_t max_sweeps) {
+                static_assert(URow >= UCol, "One-sided Jacobi requires a tall working matrix.");
+                for (size_t sweep = 0; sweep < max_sweeps; ++sweep) {
+                    bool rotated = false;
+                    for (size_t p = 0; p < UCol; ++p) {
+                        for (size_t q = p + 1; q < UCol; ++q) {
+                            T alpha = 0, beta = 0, gamma = 0;
+                            for (size_t i = 0; i < URow; ++i) {
+                                alpha += U[i][p] * U[i][p];
+                                beta += U[i][q] * U[i][q];
+                                gamma += U[i][p] * U[i][q];
+                            }
+                            if (gamma == 0 || abs(gamma) <= epsilon<T>() * sqrt(alpha * beta)) continue;
+                            rotated = true;
+
+                            const T zeta = (beta - alpha) / (2 * gamma);
+                            T t          = 1 / (abs(zeta) + sqrt(zeta * zeta + 1));
+                            if (zeta < 0) t = -t;
+                            const T c = 1 / sqrt(t * t + 1);
+                            const T sn = t * c;
+
+                            for (size_t i = 0; i < URow; ++i) {
+                                const T up = U[i][p];
+                                const T uq = U[i][q];
+                                U[i][p]    = c * up - sn * uq;
+                                U[i][q]    = sn * up + c * uq;
+                            }
+                            for (size_t i = 0; i < UCol; ++i) {
+                                const T vp = V[i][p];
+                                const T vq = V[i][q];
+                                V[i][p]    = c * vp - sn * vq;
+                                V[i][q]    = sn * vp + c * vq;
+                            }
+                        }
+                    }
+                    if (!rotated) break;
+                }
+
+                for (size_t j = 0; j < UCol; ++j) {
+                    T acc = 0;
+                    for (size_t i = 0; i < URow; ++i) acc += U[i][j] * U[i][j];
+                    s[j] = sqrt(acc);
+                    if (s[j] > 0)
+                        for (size_t i = 0; i < URow; ++i) U[i][j] /= s[j];
+                }
+
+                for (size_t i = 0; i < UCol; ++i) {
+                    size_t k = i;
+                    for (size_t j = i + 1; j < UCol; ++j)
+                        if (s[j] > s[k]) k = j;
+                    if (k != i) {
+                        vt::swap(s[i], s[k]);
+                        for (size_t r = 0; r < URow; ++r) vt::swap(U[r][i], U[r][k]);
+                        for (size_t r = 0; r < UCol; ++r) vt::swap(V[r][i], V[r][k]);
+                    }
+                }
+            }
+
             template<size_t OSize>
             static numeric_matrix_static_t<T, OSize, OSize> inv_lt(numeric_matrix_static_t<T, OSize, OSize> &L) {
                 static_assert(static_is_a_square_matrix(), "Can only inverse a square matrix.");
@@ -1067,6 +1476,78 @@ namespace vt {
         return A.RRE();
     }
 
+    /**
+     * Finds matrix exponential e^A of this matrix.\n
+     * If this matrix is not square, the compile-time error is thrown.
+     *
+     * @tparam T
+     * @tparam Row
+     * @tparam Col
+     * @param A
+     * @return Matrix exponential
+     */
+    template<typename T, size_t Row, size_t Col>
+    impl::numeric_matrix_static_t<T, Row, Col> expm(const impl::numeric_matrix_static_t<T, Row, Col> &A) {
+        return A.expm();
+    }
+
+    /**
+     * Finds eigen-decomposition of this symmetric matrix.\n
+     * If this matrix is not square, the compile-time error is thrown.
+     *
+     * @tparam T
+     * @tparam Row
+     * @tparam Col
+     * @param A
+     * @return Eigenvalues (ascending) and eigenvectors
+     */
+    template<typename T, size_t Row, size_t Col>
+    impl::numeric_matrix_static_eigen_t<T, Row> eigen_symmetric(const impl::numeric_matrix_static_t<T, Row, Col> &A) {
+        return A.eigen_symmetric();
+    }
+
+    /**
+     * Finds thin singular value decomposition of this matrix.
+     *
+     * @tparam T
+     * @tparam Row
+     * @tparam Col
+     * @param A
+     * @return U, singular values (descending) and V
+     */
+    template<typename T, size_t Row, size_t Col>
+    impl::numeric_matrix_static_svd_t<T, Row, Col> SVD(const impl::numeric_matrix_static_t<T, Row, Col> &A) {
+        return A.SVD();
+    }
+
+    /**
+     * Finds Moore-Penrose pseudo-inverse of this matrix.
+     *
+     * @tparam T
+     * @tparam Row
+     * @tparam Col
+     * @param A
+     * @return Pseudo-inverse
+     */
+    template<typename T, size_t Row, size_t Col>
+    impl::numeric_matrix_static_t<T, Col, Row> pinv(const impl::numeric_matrix_static_t<T, Row, Col> &A) {
+        return A.pinv();
+    }
+
+    /**
+     * Finds Cholesky factor of this symmetric matrix.
+     *
+     * @tparam T
+     * @tparam Row
+     * @tparam Col
+     * @param A
+     * @return Lower-triangular Cholesky factor
+     */
+    template<typename T, size_t Row, size_t Col>
+    impl::numeric_matrix_static_t<T, Row, Col> cholesky(const impl::numeric_matrix_static_t<T, Row, Col> &A) {
+        return A.cholesky();
+    }
+
     namespace impl {
         /**
          * Wrapper class for LU-decomposed matrix comprised of L and U square matrices.
@@ -1120,6 +1601,118 @@ namespace vt {
              */
             constexpr const Matrix_t &u() const { return u_; }
         };
+
+        /**
+         * Wrapper class for eigen-decomposed symmetric matrix comprised of eigenvalues
+         * and eigenvectors (as columns).
+         *
+         * @tparam T
+         * @tparam OSize
+         */
+        template<typename T, size_t OSize>
+        class numeric_matrix_static_eigen_t {
+        private:
+            using Vector_t = numeric_vector_static_t<T, OSize>;
+            using Matrix_t = numeric_matrix_static_t<T, OSize, OSize>;
+            Vector_t values_;
+            Matrix_t vectors_;
+
+        public:
+            numeric_matrix_static_eigen_t(const Vector_t &values, const Matrix_t &vectors)
+                : values_(values), vectors_(vectors) {}
+
+            /**
+             * Eigenvalues in ascending order
+             *
+             * @return Eigenvalues
+             */
+            constexpr const Vector_t &values() const { return values_; }
+
+            /**
+             * Orthonormal eigenvectors, column i belongs to values()[i]
+             *
+             * @return Eigenvectors as columns
+             */
+            constexpr const Matrix_t &vectors() const { return vectors_; }
+        };
+
+        /**
+         * Wrapper class for thin singular value decomposition A = U * diag(s) * V^T.
+         *
+         * @tparam T
+         * @tparam Row
+         * @tparam Col
+         */
+        template<typename T, size_t Row, size_t Col>
+        class numeric_matrix_static_svd_t {
+        private:
+            static constexpr size_t Order = (Row < Col) ? Row : Col;
+            numeric_matrix_static_t<T, Row, Order> u_;
+            numeric_vector_static_t<T, Order> s_;
+            numeric_matrix_static_t<T, Col, Order> v_;
+
+        public:
+            numeric_matrix_static_svd_t(const numeric_matrix_static_t<T, Row, Order> &u,
+                                        const numeric_vector_static_t<T, Order> &s,
+                                        const numeric_matrix_static_t<T, Col, Order> &v)
+                : u_(u), s_(s), v_(v) {}
+
+            /**
+             * Left singular vectors as columns
+             *
+             * @return U Matrix
+             */
+            constexpr const numeric_matrix_static_t<T, Row, Order> &u() const { return u_; }
+
+            /**
+             * Singular values in descending order
+             *
+             * @return Singular values
+             */
+            constexpr const numeric_vector_static_t<T, Order> &s() const { return s_; }
+
+            /**
+             * Right singular vectors as columns
+             *
+             * @return V Matrix
+             */
+            constexpr const numeric_matrix_static_t<T, Col, Order> &v() const { return v_; }
+
+            /**
+             * Numerical rank, counting singular values above the tolerance.
+             *
+             * @return Rank
+             */
+            size_t rank() const {
+                const T tol = tolerance();
+                size_t r    = 0;
+                for (size_t i = 0; i < Order; ++i)
+                    if (s_[i] > tol) ++r;
+                return r;
+            }
+
+            /**
+             * Moore-Penrose pseudo-inverse V * diag(1 / s) * U^T.
+             *
+             * @return Pseudo-inverse
+             */
+            numeric_matrix_static_t<T, Col, Row> pinv() const {
+                const T tol = tolerance();
+                numeric_matrix_static_t<T, Col, Row> result;
+                for (size_t k = 0; k < Order; ++k) {
+                    if (s_[k] <= tol) continue;
+                    const T inv_s = 1 / s_[k];
+                    for (size_t i = 0; i < Col; ++i) {
+                        const T vik = v_[i][k] * inv_s;
+                        for (size_t j = 0; j < Row; ++j) result[i][j] += vik * u_[j][k];
+                    }
+                }
+                return result;
+            }
+
+        private:
+            T tolerance() const { return static_cast<T>(Row > Col ? Row : Col) * epsilon<T>() * s_[0]; }
+        };
     }  // namespace impl
 
     template<typename T, size_t Row, size_t Col = Row>
@@ -1158,6 +1751,12 @@ namespace vt {
     template<size_t OSize>
     using numeric_matrix_lu = impl::numeric_matrix_static_lu_t<real_t, OSize>;
 
+    template<size_t OSize>
+    using numeric_matrix_eigen = impl::numeric_matrix_static_eigen_t<real_t, OSize>;
+
+    template<size_t Row, size_t Col = Row>
+    using numeric_matrix_svd = impl::numeric_matrix_static_svd_t<real_t, Row, Col>;
+
     /**
      *
      * @tparam Row Row dimension
@@ -293,7 +293,7 @@ namespace vt {
                 numeric_matrix_static_t<T, Size, OSize> result;
                 for (size_t i = 0; i < Size; ++i)
                     for (size_t j = 0; j < OSize; ++j)
-                        result[i][j] = arr_[i] * other.arr_[j];
+                        result[i][j] = arr_[i] * other[j];
                 return result;
             }
 
@@ -0,0 +1,274 @@
+/**
+ * @file particle_filter.h
+ * @brief Bootstrap particle filter with structure-of-arrays particle storage
+ */
+
+#ifndef VT_LINALG_PARTICLE_FILTER_H
+#define VT_LINALG_PARTICLE_FILTER_H
+
+#include "numeric_matrix.h"
+#include "numeric_vector.h"
+#include "random.h"
+#include "standard_utility.h"
+
+namespace vt {
+    namespace detail {
+        template<size_t N, size_t L>
+        using particle_propagate_func_t = void (*)(numeric_vector<N> &, const numeric_vector<L> &, xorshift_t &);
+
+        template<size_t N, size_t M>
+        using particle_likelihood_func_t = real_t (*)(const numeric_vector<N> &, const numeric_vector<M> &);
+    }  // namespace detail
+
+    /**
+     * Bootstrap (sequential importance resampling) particle filter.\n
+     * Particles are stored as N columns of Particles entries, so every per-particle stage walks
+     * contiguous memory and the model callables inline into loops the compiler can vectorize.
+     * Propagation and weighting draw from a generator seeded by (seed, step, particle), which keeps
+     * results identical with any number of threads. When compiled with OpenMP, the propagate,
+     * likelihood and resampling gather loops run multi-threaded.\n
+     * Resampling is systematic, O(Particles), and runs when the effective sample size falls below
+     * the threshold fraction of Particles.\n
+     * Storage is a member array, so large particle counts should have static storage duration.
+     *
+     * @tparam StateVectorDimension State vector dimension
+     * @tparam MeasurementVectorDimension Measurement vector dimension
+     * @tparam ControlVectorDimension Control vector dimension
+     * @tparam Particles Number of particles
+     * @tparam Propagate Callable as f(x, u, rng), advancing x in place with process noise drawn from rng
+     * @tparam LogLikelihood Callable as g(x, z), returning log p(z | x) up to a constant
+     */
+    template<size_t StateVectorDimension, size_t MeasurementVectorDimension, size_t ControlVectorDimension, size_t Particles,
+             typename Propagate     = detail::particle_propagate_func_t<StateVectorDimension, ControlVectorDimension>,
+             typename LogLikelihood = detail::particle_likelihood_func_t<StateVectorDimension, MeasurementVectorDimension>>
+    class particle_filter_t {
+    public:
+        static_assert(Particles > 0, "Particle filter needs at least one particle.");
+
+    private:
+        static constexpr size_t N_ = StateVectorDimension;        // ALias
+        static constexpr size_t M_ = MeasurementVectorDimension;  // Alias
+        static constexpr size_t L_ = ControlVectorDimension;      // Alias
+        static constexpr size_t P_ = Particles;                   // Alias
+
+    protected:
+        Propagate f_;                    // process model
+        LogLikelihood g_;                // measurement log-likelihood
+        numeric_vector<P_> x_[N_];       // particle states, one column per state component
+        numeric_vector<P_> w_;           // normalized weights
+        numeric_vector<P_> scratch_;     // log-likelihoods, resampling gather buffer
+        size_t index_[P_];               // resampled ancestor indices
+        numeric_vector<N_> x_mean_;      // weighted mean
+        xorshift_t rng_;                 // generator for initialization and resampling
+        uint64_t seed_;                  // base seed of per-particle generators
+        uint64_t step_;                  // number of propagations
+        real_t resample_threshold_;      // resample when ESS < threshold * Particles
+        real_t ess_;                     // effective sample size after the latest update
+
+    public:
+        /**
+         * Particle filter constructor, draws initial particles from N(x_0, diag(sigma_0^2))
+         *
+         * @param f_func process model
+         * @param g_func measurement log-likelihood
+         * @param x_0 initial state vector
+         * @param sigma_0 initial standard deviation of each state component
+         * @param seed random seed
+         */
+        particle_filter_t(Propagate f_func, LogLikelihood g_func,
+                          const numeric_vector<N_> &x_0, const numeric_vector<N_> &sigma_0,
+                          uint64_t seed = 1)
+            : f_(f_func), g_(g_func), rng_(seed), seed_(splitmix64(seed)), step_(0),
+              resample_threshold_(0.5), ess_(static_cast<real_t>(P_)) {
+            initialize(x_0, sigma_0);
+        }
+
+        /**
+         * Redraws all particles from N(x_0, diag(sigma_0^2)) with uniform weights
+         *
+         * @param x_0 initial state vector
+         * @param sigma_0 initial standard deviation of each state component
+         */
+        particle_filter_t &initialize(const numeric_vector<N_> &x_0, const numeric_vector<N_> &sigma_0) {
+            for (size_t d = 0; d < N_; ++d)
+                for (size_t i = 0; i < P_; ++i) x_[d][i] = rng_.normal(x_0[d], sigma_0[d]);
+            for (size_t i = 0; i < P_; ++i) w_[i] = 1. / static_cast<real_t>(P_);
+            ess_ = static_cast<real_t>(P_);
+            estimate();
+            return *this;
+        }
+
+        /**
+         * Propagates every particle through the process model
+         *
+         * @param u control input vector
+         */
+        particle_filter_t &predict(const numeric_vector<L_> &u = {}) {
+            const uint64_t base_ = splitmix64(seed_ ^ splitmix64(step_));
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+            for (size_t i = 0; i < P_; ++i) {
+                numeric_vector<N_> x_i;
+                for (size_t d = 0; d < N_; ++d) x_i[d] = x_[d][i];
+                xorshift_t rng_i(base_ + i);
+                f_(x_i, u, rng_i);
+                for (size_t d = 0; d < N_; ++d) x_[d][i] = x_i[d];
+            }
+            ++step_;
+            estimate();
+            return *this;
+        }
+
+        /**
+         * Reweights particles by the measurement likelihood, resampling when degenerate
+         *
+         * @param z Measurement vector
+         */
+        particle_filter_t &update(const numeric_vector<M_> &z) {
+            real_t max_log_ = -HUGE_VAL;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(max : max_log_)
+#endif
+            for (size_t i = 0; i < P_; ++i) {
+                numeric_vector<N_> x_i;
+                for (size_t d = 0; d < N_; ++d) x_i[d] = x_[d][i];
+                scratch_[i] = g_(x_i, z);
+                if (scratch_[i] > max_log_) max_log_ = scratch_[i];
+            }
+
+            // w_i <- w_i exp(l_i - max l), scaled to avoid underflow
+            real_t sum_ = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(+ : sum_)
+#endif
+            for (size_t i = 0; i < P_; ++i) {
+                w_[i] *= exp(scratch_[i] - max_log_);
+                sum_ += w_[i];
+            }
+
+            if (!(sum_ > 0)) {
+                // Every particle is impossible under z, restart from uniform weights
+                for (size_t i = 0; i < P_; ++i) w_[i] = 1. / static_cast<real_t>(P_);
+            } else {
+                w_ /= sum_;
+            }
+
+            ess_ = 1. / w_.dot(w_);
+            if (ess_ < resample_threshold_ * static_cast<real_t>(P_)) resample();
+            estimate();
+            return *this;
+        }
+
+        particle_filter_t &operator<<(const numeric_vector<M_> &z) {
+            return predict().update(z);
+        }
+
+        template<typename... Ts>
+        particle_filter_t &update(Ts... vs) { return update(make_numeric_vector({vs...})); }
+
+        /**
+         * Systematic resampling: one uniform offset, Particles evenly spaced pointers
+         * into the cumulative weights, then a gather of each state column
+         */
+        particle_filter_t &resample() {
+            const real_t step_u = 1. / static_cast<real_t>(P_);
+            real_t u_           = rng_.uniform() * step_u;
+            real_t c_           = w_[0];
+            size_t j            = 0;
+            for (size_t i = 0; i < P_; ++i, u_ += step_u) {
+                while (u_ > c_ && j < P_ - 1) c_ += w_[++j];
+                index_[i] = j;
+            }
+
+            for (size_t d = 0; d < N_; ++d) {
+                numeric_vector<P_> &col_ = x_[d];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                for (size_t i = 0; i < P_; ++i) scratch_[i] = col_[index_[i]];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+                for (size_t i = 0; i < P_; ++i) col_[i] = scratch_[i];
+            }
+
+            for (size_t i = 0; i < P_; ++i) w_[i] = step_u;
+            ess_ = static_cast<real_t>(P_);
+            return *this;
+        }
+
+        /**
+         * Sets the effective sample size fraction below which update() resamples
+         *
+         * @param threshold Fraction in [0, 1], 1 resamples every update, 0 never
+         */
+        particle_filter_t &set_resample_threshold(const real_t &threshold) {
+            resample_threshold_ = threshold;
+            return *this;
+        }
+
+        /**
+         * Weighted mean of the particles
+         *
+         * @return State estimate
+         */
+        const numeric_vector<N_> &state_vector() const { return x_mean_; }
+
+        /**
+         * Weighted covariance of the particles, O(Particles N^2)
+         *
+         * @return State covariance
+         */
+        numeric_matrix<N_, N_> covariance() const {
+            numeric_matrix<N_, N_> P;
+            for (size_t r = 0; r < N_; ++r)
+                for (size_t s = r; s < N_; ++s) {
+                    real_t acc_ = 0;
+                    for (size_t i = 0; i < P_; ++i) acc_ += w_[i] * (x_[r][i] - x_mean_[r]) * (x_[s][i] - x_mean_[s]);
+                    P[r][s] = P[s][r] = acc_;
+                }
+            return P;
+        }
+
+        /**
+         * State component d of every particle
+         *
+         * @param d State component
+         * @return Particle column
+         */
+        const numeric_vector<P_> &particles(size_t d) const { return x_[d]; }
+
+        const numeric_vector<P_> &weights() const { return w_; }
+
+        [[nodiscard]] constexpr real_t effective_sample_size() const { return ess_; }
+
+        [[nodiscard]] static constexpr size_t size() { return P_; }
+
+    private:
+        void estimate() {
+            for (size_t d = 0; d < N_; ++d) x_mean_[d] = w_.dot(x_[d]);
+        }
+    };
+
+    /**
+     * Creates particle filter from any process model and log-likelihood callables, e.g. lambdas.
+     *
+     * @tparam N State vector dimension
+     * @tparam M Measurement vector dimension
+     * @tparam L Control vector dimension
+     * @tparam Particles Number of particles
+     * @tparam Propagate
+     * @tparam LogLikelihood
+     * @return Particle filter
+     */
+    template<size_t N, size_t M, size_t L, size_t Particles, typename Propagate, typename LogLikelihood>
+    particle_filter_t<N, M, L, Particles, Propagate, LogLikelihood>
+    make_particle_filter(Propagate f_func, LogLikelihood g_func,
+                         const numeric_vector<N> &x_0, const numeric_vector<N> &sigma_0,
+                         uint64_t seed = 1) {
+        return {f_func, g_func, x_0, sigma_0, seed};
+    }
+}  // namespace vt
+
+#endif  //VT_LINALG_PARTICLE_FILTER_H
@@ -0,0 +1,81 @@
+/**
+ * @file random.h
+ * @brief Small deterministic pseudo-random number generators
+ */
+
+#ifndef VT_LINALG_RANDOM_H
+#define VT_LINALG_RANDOM_H
+
+#include "standard_constants.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * SplitMix64 finalizer, mixes a 64-bit key into a well-distributed 64-bit value.\n
+     * Used to derive independent generator seeds from (seed, step, index) without shared state.
+     *
+     * @param x Key
+     * @return Mixed value
+     */
+    constexpr uint64_t splitmix64(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * xorshift64* generator with uniform and Box-Muller normal variates.\n
+     * The state is 8 bytes plus one cached normal, so a generator can be created per particle or per thread.
+     */
+    class xorshift_t {
+    private:
+        uint64_t state_;
+        real_t spare_   = 0;
+        bool has_spare_ = false;
+
+    public:
+        /**
+         * Generator constructor, any seed is valid
+         *
+         * @param seed Seed
+         */
+        explicit constexpr xorshift_t(uint64_t seed = 0x2545F4914F6CDD1DULL) : state_(splitmix64(seed) | 1ULL) {}
+
+        uint64_t next() {
+            state_ ^= state_ >> 12;
+            state_ ^= state_ << 25;
+            state_ ^= state_ >> 27;
+            return state_ * 0x2545F4914F6CDD1DULL;
+        }
+
+        /**
+         * Uniform variate in [0, 1) from the top 53 bits
+         *
+         * @return Uniform variate
+         */
+        real_t uniform() { return static_cast<real_t>(next() >> 11) * (1. / 9007199254740992.); }
+
+        /**
+         * Standard normal variate, Box-Muller transform producing two variates per pair of uniforms
+         *
+         * @return Normal variate
+         */
+        real_t normal() {
+            if (has_spare_) {
+                has_spare_ = false;
+                return spare_;
+            }
+            const real_t u1 = 1. - uniform();  // (0, 1], keeps log finite
+            const real_t u2 = uniform();
+            const real_t r  = sqrt(-2. * log(u1));
+            spare_          = r * sin(TWO_PI * u2);
+            has_spare_      = true;
+            return r * cos(TWO_PI * u2);
+        }
+
+        real_t normal(const real_t &mean, const real_t &stddev) { return mean + stddev * normal(); }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_RANDOM_H
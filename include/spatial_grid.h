@@ -0,0 +1,169 @@
+/**
+ * @file spatial_grid.h
+ * @brief Uniform hash grid over points with incremental updates
+ */
+
+#ifndef VT_LINALG_SPATIAL_GRID_H
+#define VT_LINALG_SPATIAL_GRID_H
+
+#include "numeric_vector.h"
+#include "random.h"
+#include "standard_utility.h"
+
+namespace vt {
+    /**
+     * Uniform grid of cubic cells over Dims-dimensional points, hashed into Buckets chains.\n
+     * Items are identified by index in [0, MaxItems) and linked into the chain of their cell,
+     * so moving an item within its cell costs only the cell computation and moving it to another
+     * cell is an O(1) unlink and relink. Range queries visit the cells overlapping the query box.
+     * All storage is fixed-size and no allocation is made.
+     *
+     * @tparam Dims Point dimension
+     * @tparam MaxItems Item capacity
+     * @tparam Buckets Number of hash chains
+     */
+    template<size_t Dims, size_t MaxItems, size_t Buckets = MaxItems>
+    class spatial_grid_t {
+    public:
+        static_assert(Dims > 0 && MaxItems > 0 && Buckets > 0, "Grid needs non-zero dimensions and capacity.");
+
+        static constexpr size_t none = static_cast<size_t>(-1);
+
+    private:
+        static constexpr size_t D_ = Dims;      // Alias
+        static constexpr size_t I_ = MaxItems;  // Alias
+        static constexpr size_t B_ = Buckets;   // Alias
+
+    protected:
+        real_t cell_size_;      // cell edge length
+        real_t inv_cell_;       // reciprocal of the cell edge length
+        size_t head_[B_];       // first item of each chain
+        size_t next_[I_];       // next item in the chain
+        size_t prev_[I_];       // previous item in the chain
+        size_t bucket_[I_];     // chain of each item, none when absent
+        int64_t cell_[I_][D_];  // integer cell coordinates of each item
+        size_t size_;           // number of items present
+
+    public:
+        /**
+         * Grid constructor
+         *
+         * @param cell_size Cell edge length, typically about the query radius
+         */
+        explicit spatial_grid_t(const real_t &cell_size) : cell_size_{cell_size}, inv_cell_{1 / cell_size}, size_{0} {
+            for (size_t b = 0; b < B_; ++b) head_[b] = none;
+            for (size_t i = 0; i < I_; ++i) bucket_[i] = none;
+        }
+
+        /**
+         * Inserts an item or moves it to a new position
+         *
+         * @param item Item index
+         * @param p Position
+         * @return Whether the item changed cell, true on insertion
+         */
+        bool place(size_t item, const numeric_vector<D_> &p) {
+            int64_t c_[D_];
+            for (size_t d = 0; d < D_; ++d) c_[d] = coordinate(p[d]);
+
+            if (bucket_[item] != none) {
+                if (same_cell(cell_[item], c_)) return false;
+                unlink(item);
+            } else {
+                ++size_;
+            }
+
+            for (size_t d = 0; d < D_; ++d) cell_[item][d] = c_[d];
+            link(item, hash(c_));
+            return true;
+        }
+
+        /**
+         * Removes an item, does nothing if it is absent
+         *
+         * @param item Item index
+         */
+        void remove(size_t item) {
+            if (bucket_[item] == none) return;
+            unlink(item);
+            bucket_[item] = none;
+            --size_;
+        }
+
+        void clear() {
+            for (size_t b = 0; b < B_; ++b) head_[b] = none;
+            for (size_t i = 0; i < I_; ++i) bucket_[i] = none;
+            size_ = 0;
+        }
+
+        /**
+         * Visits every item whose cell overlaps the box of half-width radius around p.\n
+         * Candidates are a superset of the items within radius and are visited once each.
+         * The cost grows with (2 radius / cell_size + 1)^Dims cells, so the radius should not be much larger than a cell.
+         *
+         * @tparam Visitor Callable as visit(item)
+         * @param p Query centre
+         * @param radius Query radius
+         * @param visit Visitor
+         */
+        template<typename Visitor>
+        void query(const numeric_vector<D_> &p, const real_t &radius, Visitor &&visit) const {
+            int64_t lo_[D_], hi_[D_], c_[D_];
+            for (size_t d = 0; d < D_; ++d) {
+                lo_[d] = coordinate(p[d] - radius);
+                hi_[d] = coordinate(p[d] + radius);
+                c_[d]  = lo_[d];
+            }
+
+            // Odometer over the cells of the box
+            for (;;) {
+                for (size_t i = head_[hash(c_)]; i != none; i = next_[i])
+                    if (same_cell(cell_[i], c_)) visit(i);
+
+                size_t d = 0;
+                for (; d < D_ && c_[d] == hi_[d]; ++d) c_[d] = lo_[d];
+                if (d == D_) break;
+                ++c_[d];
+            }
+        }
+
+        [[nodiscard]] bool contains(size_t item) const { return bucket_[item] != none; }
+
+        [[nodiscard]] constexpr size_t size() const { return size_; }
+
+        [[nodiscard]] constexpr real_t cell_size() const { return cell_size_; }
+
+        [[nodiscard]] static constexpr size_t capacity() { return I_; }
+
+    private:
+        int64_t coordinate(const real_t &x) const { return static_cast<int64_t>(floor(x * inv_cell_)); }
+
+        static bool same_cell(const int64_t *a, const int64_t *b) {
+            for (size_t d = 0; d < D_; ++d)
+                if (a[d] != b[d]) return false;
+            return true;
+        }
+
+        static size_t hash(const int64_t *c) {
+            uint64_t h_ = 0;
+            for (size_t d = 0; d < D_; ++d) h_ = splitmix64(h_ ^ static_cast<uint64_t>(c[d]));
+            return static_cast<size_t>(h_ % B_);
+        }
+
+        void link(size_t item, size_t b) {
+            bucket_[item] = b;
+            prev_[item]   = none;
+            next_[item]   = head_[b];
+            if (head_[b] != none) prev_[head_[b]] = item;
+            head_[b] = item;
+        }
+
+        void unlink(size_t item) {
+            if (prev_[item] != none) next_[prev_[item]] = next_[item];
+            else head_[bucket_[item]] = next_[item];
+            if (next_[item] != none) prev_[next_[item]] = prev_[item];
+        }
+    };
+}  // namespace vt
+
+#endif  //VT_LINALG_SPATIAL_GRID_H
@@ -291,6 +291,30 @@ namespace vt {
     constexpr real_t integral_coefficient() {
         return detail::integral_coefficient_helper<real_t, N>::value;
     }
+
+    namespace detail {
+        template<typename T>
+        struct epsilon_helper {
+            static constexpr T value = static_cast<T>(2.2204460492503131e-16);
+        };
+
+        template<>
+        struct epsilon_helper<float> {
+            static constexpr float value = 1.19209290e-7F;
+        };
+    }  // namespace detail
+
+    /**
+     * Mimic std::numeric_limits<T>::epsilon().\n
+     * Types other than float fall back to double's machine epsilon.
+     *
+     * @tparam T
+     * @return Machine epsilon of T
+     */
+    template<typename T>
+    constexpr T epsilon() {
+        return detail::epsilon_helper<T>::value;
+    }
 }  // namespace vt
 
 #endif  //VT_LINALG_STANDARD_UTILITY_H
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt       = 0.1;
+constexpr size_t targets  = 6;
+constexpr size_t max_meas = 8;
+
+using associator_t = gnn_associator_t<2, targets, max_meas>;
+
+// Exhaustive search: most gated pairs first, then least total cost
+void brute_force(const numeric_matrix_bounded<targets, max_meas> &C, size_t t, bool *used,
+                 size_t count, real_t cost, size_t &best_count, real_t &best_cost) {
+    if (t == C.r()) {
+        if (count > best_count || (count == best_count && cost < best_cost)) {
+            best_count = count;
+            best_cost  = cost;
+        }
+        return;
+    }
+    brute_force(C, t + 1, used, count, cost, best_count, best_cost);
+    for (size_t d = 0; d < C.c(); ++d) {
+        if (used[d] || C[t][d] == HUGE_VAL) continue;
+        used[d] = true;
+        brute_force(C, t + 1, used, count + 1, cost + C[t][d], best_count, best_cost);
+        used[d] = false;
+    }
+}
+
+int main() {
+    const numeric_matrix<4, 4> F({{1, dt, 0, 0},
+                                  {0, 1, 0, 0},
+                                  {0, 0, 1, dt},
+                                  {0, 0, 0, 1}});
+    const numeric_matrix<4, 1> B = {};
+    const numeric_matrix<2, 4> H({{1, 0, 0, 0},
+                                  {0, 0, 1, 0}});
+    const numeric_matrix<4, 4> Q = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<2, 2> R({{0.02, 0.005},
+                                  {0.005, 0.01}});
+
+    // The cached factor matches a direct computation and the update matches the explicit-inverse form
+    {
+        kalman_filter_t<4, 2, 1> kf(F, B, H, Q, R, make_numeric_vector({0., 1., 0., -1.}));
+        kalman_filter_t<4, 2, 1> kf_ref(kf);
+        kf.set_sequential(false);
+        for (size_t k = 0; k < 20; ++k) {
+            const real_t t             = static_cast<real_t>(k) * dt;
+            const numeric_vector<2> z({t + (static_cast<real_t>(k % 5) - 2) * 0.05, -t});
+            kf.predict();
+
+            const numeric_matrix<4, 4> P  = kf.covariance();
+            const numeric_vector<4> x     = kf.state_vector;
+            const numeric_matrix<2, 2> S  = H * P.matmul_T(H) + R;
+            const numeric_matrix<2, 2> Si = S.solve(numeric_matrix<2, 2>::identity());
+            const numeric_vector<2> y     = z - H * x;
+            const numeric_matrix<2, 2> &L = kf.innovation_factor();
+            assert(L.matmul_T(L).float_equals(S, 1e-12));
+            assert(abs(kf.mahalanobis(z) - y.dot(Si * y)) < 1e-10);
+
+            const numeric_matrix<4, 2> K = P.matmul_T(H) * Si;
+            kf.update_standard(z);
+            assert(kf.state_vector.float_equals(x + K * y, 1e-10));
+            assert(kf.covariance().float_equals((numeric_matrix<4, 4>::identity() - K * H) * P, 1e-10));
+        }
+    }
+
+    // Targets on parallel lanes 1 apart, detections shuffled, with clutter and missed detections
+    kalman_filter_t<4, 2, 1> tracks[targets] = {
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 0., 0.})},
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 1., 0.})},
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 2., 0.})},
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 3., 0.})},
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 4., 0.})},
+            {F, B, H, Q, R, make_numeric_vector({0., 1., 5., 0.})},
+    };
+    for (kalman_filter_t<4, 2, 1> &track: tracks) track.set_sequential(false);
+
+    associator_t gnn(9.21);
+    size_t correct = 0, total = 0;
+    for (size_t k = 1; k <= 100; ++k) {
+        numeric_vector<2> z[max_meas];
+        size_t truth_of[max_meas];
+        size_t count = 0;
+
+        // Every 7th scan misses three targets, so tracks outnumber measurements
+        const size_t detected = k % 7 == 0 ? targets - 3 : targets;
+        for (size_t i = 0; i < detected; ++i) {
+            const size_t target = (i * 5 + k) % targets;
+            const real_t noise  = (static_cast<real_t>((k + target) % 5) - 2) * 0.05;
+            z[count]            = make_numeric_vector({static_cast<real_t>(k) * dt + noise, static_cast<real_t>(target) - noise});
+            truth_of[count++]   = target;
+        }
+        if (k % 3 == 0) {
+            z[count]          = make_numeric_vector({static_cast<real_t>(k) * dt, 20.});
+            truth_of[count++] = associator_t::unassigned;
+        }
+
+        for (kalman_filter_t<4, 2, 1> &track: tracks) track.predict();
+        gnn.associate(tracks, targets, z, count);
+
+        bool used[max_meas] = {};
+        size_t best_count   = 0;
+        real_t best_cost    = HUGE_VAL;
+        brute_force(gnn.cost(), 0, used, 0, 0, best_count, best_cost);
+        real_t cost = 0;
+        for (size_t t = 0; t < targets; ++t)
+            if (gnn.measurement_of(t) != associator_t::unassigned) cost += gnn.cost()[t][gnn.measurement_of(t)];
+        assert(gnn.assigned() == best_count);
+        assert(best_count == 0 || abs(cost - best_cost) < 1e-9);
+
+        for (size_t d = 0; d < count; ++d) {
+            const size_t t = gnn.track_of(d);
+            if (t != associator_t::unassigned) {
+                assert(gnn.measurement_of(t) == d);
+                correct += truth_of[d] == t;
+                ++total;
+            }
+        }
+        gnn.update(tracks, z);
+    }
+    assert(correct == total && total > 0);
+
+    std::cout << "Correct associations: " << correct << " of " << total << '\n';
+
+    return 0;
+}
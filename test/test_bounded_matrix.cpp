@@ -0,0 +1,115 @@
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.01;
+
+using joseph_t = kalman_filter_core_t<policy::linear_model_t<3, 4, 1>, policy::bound_noise_t<3, 4>,
+                                      policy::no_adaptation_t, policy::joseph_update_t>;
+
+int main() {
+    // Bounded operations agree with static ones on the active block
+    const numeric_matrix<3, 4> A({{1, 2, 0, -1},
+                                  {0, 3, 1, 2},
+                                  {4, -2, 1, 0}});
+    const numeric_matrix<4, 4> SPD = A.transpose() * A + numeric_matrix<4, 4>::diagonals(0.5);
+    const numeric_matrix_bounded<5, 6> Ab(A);
+    const numeric_matrix_bounded<6, 6> SPDb(SPD);
+    assert(Ab.r() == 3 && Ab.c() == 4);
+
+    const numeric_matrix<3, 4> AS           = A * SPD;
+    const numeric_matrix_bounded<5, 6> ASb  = Ab * SPDb;
+    const numeric_matrix<3, 3> AAt          = A.matmul_T(A);
+    const numeric_matrix_bounded<5, 5> AAtb = Ab.matmul_T(Ab);
+    const numeric_matrix<4, 4> L            = SPD.cholesky();
+    const numeric_matrix_bounded<6, 6> Lb   = SPDb.cholesky();
+    const numeric_matrix<4, 3> X            = L.cholesky_solve(A.transpose());
+    const numeric_matrix_bounded<6, 5> Xb   = Lb.cholesky_solve(Ab.transpose());
+    assert(ASb.float_equals(numeric_matrix_bounded<5, 6>(AS)));
+    assert(AAtb.float_equals(numeric_matrix_bounded<5, 5>(AAt)));
+    assert(Lb.float_equals(numeric_matrix_bounded<6, 6>(L)));
+    assert(Xb.float_equals(numeric_matrix_bounded<6, 5>(X), 1e-10));
+
+    const size_t rows[] = {2, 0};
+    const numeric_matrix_bounded<3, 4> A_rows(A, rows, 2);
+    const numeric_matrix_bounded<4, 4> S_sub = numeric_matrix_bounded<4, 4>::principal(SPD, rows, 2);
+    assert(A_rows.r() == 2 && A_rows[0][0] == 4 && A_rows[1][3] == -1);
+    assert(S_sub.r() == 2 && S_sub[0][1] == SPD[2][0] && S_sub[1][1] == SPD[0][0]);
+
+    numeric_matrix_bounded<4, 4> grow(2, 2);
+    grow[1][1] = 3;
+    grow.resize(3, 3);
+    assert(grow[1][1] == 3 && grow[2][2] == 0 && grow[0][2] == 0);
+
+    // Masked update matches a filter built for the active rows only
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(1.).Q + numeric_matrix<3, 3>::diagonals(1e-4);
+    const numeric_matrix<4, 3> H({{1, 0, 0},
+                                  {0, 1, 0},
+                                  {0, 0, 1},
+                                  {1, 0, 0}});
+    const numeric_matrix<4, 4> R({{0.5, 0.1, 0, 0},
+                                  {0.1, 0.3, 0, 0.05},
+                                  {0, 0, 0.2, 0},
+                                  {0, 0.05, 0, 0.4}});
+    const numeric_matrix<2, 3> H_02({{1, 0, 0},
+                                     {0, 0, 1}});
+    const numeric_matrix<2, 2> R_02({{0.5, 0},
+                                     {0, 0.2}});
+    const numeric_matrix<4, 4> R_diag = numeric_matrix<4, 4>::diagonals(0.3);
+    const numeric_vector<3> x0        = {};
+
+    kalman_filter_t<3, 4, 1> kf(F, B, H, Q, R, x0);
+    kalman_filter_t<3, 2, 1> kf_02(F, B, H_02, Q, R_02, x0);
+    kalman_filter_t<3, 4, 1> kf_seq(F, B, H, Q, R_diag, x0);
+    kalman_filter_t<3, 4, 1> kf_seq_ref(F, B, H, Q, R_diag, x0);
+    assert(!kf.is_sequential() && kf_seq.is_sequential());
+    kf_02.set_sequential(false);
+
+    const bool mask_02[4]   = {true, false, true, false};
+    const bool mask_all[4]  = {true, true, true, true};
+    const bool mask_none[4] = {};
+    for (size_t k = 0; k < 300; ++k) {
+        const real_t t     = static_cast<real_t>(k) * dt;
+        const real_t noise = (static_cast<real_t>(k % 5) - 2) * 0.05;
+        const numeric_vector<4> z({t * t + noise, 2 * t - noise, 2 + noise, t * t - noise});
+
+        kf.predict().update(z, mask_02);
+        kf_02.predict().update(make_numeric_vector({z[0], z[2]}));
+        assert(kf.state_vector.float_equals(kf_02.state_vector, 1e-9));
+        assert(kf.covariance().float_equals(kf_02.covariance(), 1e-9));
+
+        kf_seq.predict().update(z, k % 3 ? mask_all : mask_none);
+        kf_seq_ref.predict();
+        if (k % 3) kf_seq_ref.update(z);
+        assert(kf_seq.state_vector.float_equals(kf_seq_ref.state_vector, 1e-9));
+    }
+
+    // All rows active reproduces the standard update, and masked Joseph updates agree with the plain form
+    kalman_filter_t<3, 4, 1> kf_full(F, B, H, Q, R, x0);
+    kalman_filter_t<3, 4, 1> kf_mask(F, B, H, Q, R, x0);
+    kalman_filter_t<3, 4, 1> kf_masked(F, B, H, Q, R, x0);
+    joseph_t kf_joseph(F, B, H, Q, R, x0);
+    for (size_t k = 0; k < 100; ++k) {
+        const real_t t = static_cast<real_t>(k) * dt;
+        const numeric_vector<4> z({t, 1, 0, t});
+        kf_full.predict().update(z);
+        kf_mask.predict().update(z, mask_all);
+        assert(kf_full.state_vector.float_equals(kf_mask.state_vector, 1e-9));
+
+        kf_joseph.predict().update(z, k % 2 ? mask_all : mask_02);
+        kf_masked.predict().update(z, k % 2 ? mask_all : mask_02);
+        assert(kf_joseph.state_vector.float_equals(kf_masked.state_vector, 1e-9));
+        assert(kf_joseph.covariance().float_equals(kf_masked.covariance(), 1e-9));
+    }
+
+    std::cout << "Masked state: ";
+    for (auto &x: kf.state_vector) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <vt_linalg>
+#include <assert.h>
+
+using namespace vt;
+
+template<size_t Row, size_t Col>
+bool near(const numeric_matrix<Row, Col> &A, const numeric_matrix<Row, Col> &B, real_t tol = 1e-9) {
+    for (size_t i = 0; i < Row; ++i)
+        if (!A[i].float_equals(B[i], tol)) return false;
+    return true;
+}
+
+int main() {
+    // Symmetric eigen-decomposition
+    numeric_matrix<3> S({{4, 1, 2},
+                         {1, 3, 0},
+                         {2, 0, 5}});
+    auto eig = S.eigen_symmetric();
+
+    for (size_t i = 1; i < 3; ++i) assert(eig.values()[i - 1] <= eig.values()[i]);
+    assert(abs(eig.values().sum() - S.tr()) < 1e-9);
+    assert(near(eig.vectors().matmul_T(eig.vectors()), numeric_matrix<3>::identity()));
+
+    numeric_matrix<3> Lambda;
+    for (size_t i = 0; i < 3; ++i) Lambda[i][i] = eig.values()[i];
+    assert(near(eig.vectors() * Lambda.matmul_T(eig.vectors()), S));
+
+    auto eig_diag = eigen_symmetric(make_diagonal_matrix({3, 1, 2}));
+    assert(eig_diag.values().float_equals(make_numeric_vector({1, 2, 3})));
+
+    // 12 x 12 covariance-like matrix
+    numeric_matrix<12> P;
+    for (size_t i = 0; i < 12; ++i)
+        for (size_t j = 0; j < 12; ++j)
+            P[i][j] = 1. / static_cast<real_t>(i + j + 1) + (i == j ? 1. : 0.);
+    auto eig_P = P.eigen_symmetric();
+    assert(eig_P.values()[0] > 0);
+    numeric_matrix<12> Lambda_P;
+    for (size_t i = 0; i < 12; ++i) Lambda_P[i][i] = eig_P.values()[i];
+    assert(near(eig_P.vectors() * Lambda_P.matmul_T(eig_P.vectors()), P, 1e-8));
+
+    // Singular value decomposition (tall)
+    numeric_matrix<4, 3> A({{1, 2, 3},
+                            {4, 5, 6},
+                            {7, 8, 10},
+                            {1, 0, 1}});
+    auto svd = A.SVD();
+    for (size_t i = 1; i < 3; ++i) assert(svd.s()[i - 1] >= svd.s()[i]);
+    numeric_matrix<3> Sigma;
+    for (size_t i = 0; i < 3; ++i) Sigma[i][i] = svd.s()[i];
+    assert(near(svd.u() * Sigma.matmul_T(svd.v()), A));
+    assert(near(svd.u().transpose() * svd.u(), numeric_matrix<3>::identity()));
+    assert(svd.rank() == 3);
+
+    // Pseudo-inverse of full column rank matrix is a left inverse
+    assert(near(A.pinv() * A, numeric_matrix<3>::identity()));
+
+    // Singular value decomposition (wide, rank deficient)
+    numeric_matrix<2, 3> W({{1, 2, 3},
+                            {2, 4, 6}});
+    auto svd_w = SVD(W);
+    assert(svd_w.rank() == 1);
+    numeric_matrix<2> Sigma_w;
+    for (size_t i = 0; i < 2; ++i) Sigma_w[i][i] = svd_w.s()[i];
+    assert(near(svd_w.u() * Sigma_w.matmul_T(svd_w.v()), W));
+    assert(near(W * pinv(W) * W, W));
+
+    // Square pseudo-inverse agrees with inverse
+    numeric_matrix<3> C({{2, 0, 2},
+                         {0, 4, 2},
+                         {2, 2, 2}});
+    assert(near(C.pinv(), inv(C)));
+
+    // Single precision
+    generic_matrix<float, 2> Sf({{2.f, 1.f},
+                                 {1.f, 2.f}});
+    auto eig_f = Sf.eigen_symmetric();
+    assert(fabsf(eig_f.values()[0] - 1.f) < 1e-5f);
+    assert(fabsf(eig_f.values()[1] - 3.f) < 1e-5f);
+
+    std::cout << "Eigenvalues of S: ";
+    for (auto &x: eig.values()) std::cout << x << ' ';
+    std::cout << "\nSingular values of A: ";
+    for (auto &x: svd.s()) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.1;
+
+using monitor_t = innovation_monitor_t<2, 100>;
+
+const numeric_matrix<4, 4> F({{1, dt, 0, 0},
+                              {0, 1, 0, 0},
+                              {0, 0, 1, dt},
+                              {0, 0, 0, 1}});
+const numeric_matrix<2, 4> H({{1, 0, 0, 0},
+                              {0, 0, 1, 0}});
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) { return F * x; }
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) { return F; }
+
+numeric_vector<2> h(const numeric_vector<4> &x) { return H * x; }
+
+numeric_matrix<2, 4> Hj(const numeric_vector<4> &) { return H; }
+
+int main() {
+    const numeric_matrix<4, 1> B    = {};
+    const numeric_vector<4> q_sd    = make_numeric_vector({0.01, 0.03, 0.01, 0.03});
+    numeric_matrix<4, 4> Q;
+    for (size_t i = 0; i < 4; ++i) Q[i][i] = q_sd[i] * q_sd[i];
+    const numeric_matrix<2, 2> R    = numeric_matrix<2, 2>::diagonals(0.04);
+    const numeric_matrix<2, 2> R_lo = numeric_matrix<2, 2>::diagonals(0.004);
+    const numeric_vector<4> x0      = make_numeric_vector({0., 1., 0., 0.5});
+
+    kalman_filter_t<4, 2, 1> kf(F, B, H, Q, R, x0);
+    kalman_filter_t<4, 2, 1, monitor_t> kf_seq(F, B, H, Q, R, x0);
+    kalman_filter_t<4, 2, 1, monitor_t> kf_std(F, B, H, Q, R, x0);
+    kalman_filter_t<4, 2, 1, monitor_t> kf_lo(F, B, H, Q, R_lo, x0);
+    extended_kalman_filter_t<4, 2, 1, detail::state_func_t<4, 1>, detail::state_jacobian_t<4, 1>,
+                             detail::observation_func_t<4, 2>, detail::observation_jacobian_t<4, 2>, monitor_t>
+            ekf(f, Fj, h, Hj, Q, R, x0);
+    auto ekf_std = make_extended_kalman_filter<4, 2, 1, monitor_t>(f, Fj, h, Hj, Q, R, x0);
+    kf_std.set_sequential(false);
+    ekf_std.set_sequential(false);
+    assert(kf_seq.is_sequential() && ekf.is_sequential());
+
+    chi_square_window_t<100> nees_window(4);
+    xorshift_t rng(17);
+    numeric_vector<4> truth = x0;
+    size_t consistent = 0, consistent_lo = 0;
+    for (size_t k = 0; k < 1000; ++k) {
+        truth = F * truth;
+        for (size_t i = 0; i < 4; ++i) truth[i] += rng.normal(0, q_sd[i]);
+        const numeric_vector<2> z({truth[0] + rng.normal(0, 0.2), truth[2] + rng.normal(0, 0.2)});
+
+        kf.predict();
+        kf_seq.predict();
+        kf_std.predict();
+        kf_lo.predict();
+        ekf.predict();
+        ekf_std.predict();
+
+        // NIS from the prior against an explicit inverse
+        const numeric_vector<2> y    = z - H * kf_std.state_vector;
+        const numeric_matrix<2, 2> S = H * kf_std.covariance().matmul_T(H) + R;
+        const real_t nis             = y.dot(S.solve(y));
+
+        kf.update(z);
+        kf_seq.update(z);
+        kf_std.update(z);
+        kf_lo.update(z);
+        ekf.update(z);
+        ekf_std.update(z);
+
+        // The hook does not change the estimate
+        assert(kf_seq.state_vector.float_equals(kf.state_vector, 0));
+        assert(kf_seq.covariance().float_equals(kf.covariance(), 0));
+
+        assert(abs(kf_std.diagnostics().nis() - nis) < 1e-9);
+        assert(abs(kf_seq.diagnostics().nis() - nis) < 1e-9);
+        assert(abs(ekf.diagnostics().nis() - nis) < 1e-9);
+        assert(abs(ekf_std.diagnostics().nis() - nis) < 1e-9);
+        assert(kf_seq.diagnostics().innovation().float_equals(y, 1e-12));
+        assert(kf_std.diagnostics().innovation_covariance().float_equals(S, 1e-12));
+        assert(kf_seq.diagnostics().innovation_covariance().float_equals(S, 1e-12));
+
+        nees_window.push(nees(kf_std.state_vector - truth, kf_std.covariance()));
+        if (k >= 100) {
+            consistent += kf_std.diagnostics().window().is_consistent();
+            consistent_lo += kf_lo.diagnostics().window().is_consistent();
+        }
+    }
+
+    // Matched noise passes the 95% test on most windows, R ten times too small fails on all
+    assert(kf_std.diagnostics().window().size() == 100 && kf_std.diagnostics().window().dof() == 200);
+    assert(consistent > 800 && consistent_lo == 0);
+    assert(abs(nees_window.mean() - 4) < 1.5);
+    assert(chi_square_quantile(200, 0) > 199 && chi_square_quantile(200, 0) < 200);
+
+    std::cout << "Mean NIS over the last window: " << kf_std.diagnostics().window().mean()
+              << ", mean NEES: " << nees_window.mean()
+              << ", consistent windows: " << consistent << " of 900, with R too small: " << consistent_lo << '\n';
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+#include <type_traits>
+
+using namespace vt;
+
+constexpr real_t dt = 0.1;
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt * x[2], x[1] + dt * x[3], x[2], x[3]});
+}
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) {
+    return make_numeric_matrix<4, 4>({{1, 0, dt, 0},
+                                      {0, 1, 0, dt},
+                                      {0, 0, 1, 0},
+                                      {0, 0, 0, 1}});
+}
+
+numeric_vector<2> h(const numeric_vector<4> &x) {
+    return make_numeric_vector({sqrt(x[0] * x[0] + x[1] * x[1]), atan2(x[1], x[0])});
+}
+
+numeric_matrix<2, 4> Hj(const numeric_vector<4> &x) {
+    const real_t r2 = x[0] * x[0] + x[1] * x[1];
+    const real_t r  = sqrt(r2);
+    return make_numeric_matrix<2, 4>({{x[0] / r, x[1] / r, 0, 0},
+                                      {-x[1] / r2, x[0] / r2, 0, 0}});
+}
+
+int main() {
+    // Scalar derivatives
+    const dual_number<> a(0.7, 0);
+    assert(abs((sin(a) * exp(a)).dual(0) - (cos(0.7) + sin(0.7)) * exp(0.7)) < 1e-12);
+    assert(abs((2 / a).dual(0) + 2 / (0.7 * 0.7)) < 1e-12);
+    assert(abs(pow(a, 3).dual(0) - 3 * 0.7 * 0.7) < 1e-12);
+    assert(abs(sqrt(a * a + 1).dual(0) - 0.7 / sqrt(0.7 * 0.7 + 1)) < 1e-12);
+    assert(abs(log(a).dual(0) - 1 / 0.7) < 1e-12);
+
+    // Multi-direction: gradient of g(x, y) = x y + atan2(y, x) in one pass
+    const dual_number<2> x(1.5, 0), y(-0.5, 1);
+    const dual_number<2> g = x * y + atan2(y, x);
+    assert(abs(g.dual(0) - (-0.5 + 0.5 / 2.5)) < 1e-12);
+    assert(abs(g.dual(1) - (1.5 + 1.5 / 2.5)) < 1e-12);
+
+    // Dual numbers inside numeric vectors
+    const numeric_vector<4> x0({9, 6, 0.5, 0});
+    const auto x0d   = make_dual_vector(x0);
+    const auto hx    = generic_vector<dual_number<4>, 2>({sqrt(x0d[0] * x0d[0] + x0d[1] * x0d[1]), atan2(x0d[1], x0d[0])});
+    assert(dual_value(hx).float_equals(h(x0)));
+    assert(dual_jacobian(hx).float_equals(Hj(x0), 1e-12));
+
+    // EKF with Jacobians from automatic differentiation matches the hand-written ones
+    const numeric_matrix<4, 4> Q = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<2, 2> R({{0.04, 0.001},
+                                  {0.001, 0.0004}});
+
+    extended_kalman_filter_t<4, 2, 1> ekf(f, Fj, h, Hj, Q, R, x0);
+    auto ekf_ad = make_autodiff_extended_kalman_filter<4, 2, 1>(
+            [](const auto &x, const numeric_vector<1> &) {
+                using vector_t = typename std::decay<decltype(x)>::type;
+                return vector_t({x[0] + dt * x[2], x[1] + dt * x[3], x[2], x[3]});
+            },
+            [](const auto &x) {
+                using scalar_t = typename std::decay<decltype(x[0])>::type;
+                return generic_vector<scalar_t, 2>({sqrt(x[0] * x[0] + x[1] * x[1]), atan2(x[1], x[0])});
+            },
+            Q, R, x0);
+
+    numeric_vector<4> truth({10, 5, 1, -0.5});
+    for (int k = 0; k < 100; ++k) {
+        truth                     = f(truth, {});
+        const real_t n            = ((k % 7) - 3) / 3.;
+        const numeric_vector<2> z = h(truth) + make_numeric_vector({0.2 * n, 0.02 * -n});
+        ekf.predict().update(z);
+        ekf_ad.predict().update(z);
+        assert(ekf_ad.state_vector.float_equals(ekf.state_vector, 1e-10));
+    }
+
+    std::cout << "Autodiff EKF state: ";
+    for (auto &v: ekf_ad.state_vector) std::cout << v << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
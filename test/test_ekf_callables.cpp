@@ -0,0 +1,90 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt0 = 0.1;
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt0 * x[2], x[1] + dt0 * x[3], x[2], x[3]});
+}
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) {
+    return make_numeric_matrix<4, 4>({{1, 0, dt0, 0},
+                                      {0, 1, 0, dt0},
+                                      {0, 0, 1, 0},
+                                      {0, 0, 0, 1}});
+}
+
+numeric_vector<2> h(const numeric_vector<4> &x) {
+    return make_numeric_vector({sqrt(x[0] * x[0] + x[1] * x[1]), atan2(x[1], x[0])});
+}
+
+numeric_matrix<2, 4> Hj(const numeric_vector<4> &x) {
+    const real_t r2 = x[0] * x[0] + x[1] * x[1];
+    const real_t r  = sqrt(r2);
+    return make_numeric_matrix<2, 4>({{x[0] / r, x[1] / r, 0, 0},
+                                      {-x[1] / r2, x[0] / r2, 0, 0}});
+}
+
+int main() {
+    const numeric_matrix<4, 4> Q = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<2, 2> R({{0.04, 0.001},
+                                  {0.001, 0.0004}});
+    const numeric_vector<4> x0({9, 6, 0.5, 0});
+
+    // Function pointers (default template arguments)
+    extended_kalman_filter_t<4, 2, 1> ekf(f, Fj, h, Hj, Q, R, x0);
+
+    // Lambdas capturing the sampling period
+    real_t dt    = dt0;
+    auto ekf_cap = make_extended_kalman_filter<4, 2, 1>(
+            [&dt](const numeric_vector<4> &x, const numeric_vector<1> &) {
+                return make_numeric_vector({x[0] + dt * x[2], x[1] + dt * x[3], x[2], x[3]});
+            },
+            [&dt](const numeric_vector<4> &, const numeric_vector<1> &) {
+                return make_numeric_matrix<4, 4>({{1, 0, dt, 0},
+                                                  {0, 1, 0, dt},
+                                                  {0, 0, 1, 0},
+                                                  {0, 0, 0, 1}});
+            },
+            h, Hj, Q, R, x0);
+
+    // Combined evaluators, one call yields value and Jacobian
+    size_t f_calls = 0, h_calls = 0;
+    auto ekf_lin   = make_extended_kalman_filter<4, 2, 1>(
+            [&](const numeric_vector<4> &x, const numeric_vector<1> &u) {
+                ++f_calls;
+                return linearization_t<4, 4>{f(x, u), Fj(x, u)};
+            },
+            [&](const numeric_vector<4> &x) {
+                ++h_calls;
+                const real_t r2 = x[0] * x[0] + x[1] * x[1];
+                const real_t r  = sqrt(r2);
+                return linearization_t<2, 4>{make_numeric_vector({r, atan2(x[1], x[0])}),
+                                             make_numeric_matrix<2, 4>({{x[0] / r, x[1] / r, 0, 0},
+                                                                        {-x[1] / r2, x[0] / r2, 0, 0}})};
+            },
+            Q, R, x0);
+
+    numeric_vector<4> truth({10, 5, 1, -0.5});
+    for (int k = 0; k < 100; ++k) {
+        truth                     = f(truth, {});
+        const real_t n            = ((k % 7) - 3) / 3.;
+        const numeric_vector<2> z = h(truth) + make_numeric_vector({0.2 * n, 0.02 * -n});
+        ekf.predict().update(z);
+        ekf_cap.predict().update(z);
+        ekf_lin.predict().update(z);
+        assert(ekf_cap.state_vector.float_equals(ekf.state_vector, 1e-12));
+        assert(ekf_lin.state_vector.float_equals(ekf.state_vector, 1e-12));
+    }
+    assert(f_calls == 100 && h_calls == 100);
+    assert((ekf.state_vector - truth).norm() < 0.5);
+
+    std::cout << "EKF state: ";
+    for (auto &x: ekf_lin.state_vector) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.05;
+constexpr size_t n  = 40;
+
+numeric_vector<3> f_lin(const numeric_vector<3> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt * x[1], x[1] + dt * x[2], x[2]});
+}
+
+numeric_vector<2> h_lin(const numeric_vector<3> &x) { return make_numeric_vector({x[0], x[0] + x[2]}); }
+
+// Lorenz-96 with forcing 8, one RK4 step
+numeric_vector<n> l96_rate(const numeric_vector<n> &x) {
+    numeric_vector<n> dx;
+    for (size_t i = 0; i < n; ++i) dx[i] = (x[(i + 1) % n] - x[(i + n - 2) % n]) * x[(i + n - 1) % n] - x[i] + 8;
+    return dx;
+}
+
+numeric_vector<n> l96(const numeric_vector<n> &x, const numeric_vector<1> &) {
+    const real_t h            = 0.01;
+    const numeric_vector<n> k1 = l96_rate(x);
+    const numeric_vector<n> k2 = l96_rate(x + k1 * (h / 2));
+    const numeric_vector<n> k3 = l96_rate(x + k2 * (h / 2));
+    const numeric_vector<n> k4 = l96_rate(x + k3 * h);
+    return x + (k1 + k2 * 2 + k3 * 2 + k4) * (h / 6);
+}
+
+// Every other component is observed
+numeric_vector<n / 2> l96_h(const numeric_vector<n> &x) {
+    numeric_vector<n / 2> z;
+    for (size_t i = 0; i < n / 2; ++i) z[i] = x[2 * i];
+    return z;
+}
+
+int main() {
+    // Linear model: the analysis equals the Kalman update of the ensemble mean and sample covariance
+    {
+        const numeric_matrix<3, 3> Q = numeric_matrix<3, 3>::diagonals(1e-3);
+        const numeric_matrix<2, 2> R({{0.2, 0.05},
+                                      {0.05, 0.1}});
+        const numeric_matrix<2, 3> H({{1, 0, 0},
+                                      {1, 0, 1}});
+        ensemble_kalman_filter_t<3, 2, 1, 12> enkf(f_lin, h_lin, Q, R, make_numeric_vector({0., 1., 0.}), make_numeric_vector({1., 1., 1.}), 5);
+
+        for (size_t k = 0; k < 50; ++k) {
+            const real_t t = static_cast<real_t>(k) * dt;
+            const numeric_vector<2> z({t + (static_cast<real_t>(k % 5) - 2) * 0.1, t + 0.5});
+            enkf.predict();
+
+            const numeric_vector<3> x_f    = enkf.state_vector();
+            const numeric_matrix<3, 3> P_f = enkf.covariance();
+            const numeric_matrix<2, 2> S   = H * P_f.matmul_T(H) + R;
+            const numeric_matrix<3, 2> K   = P_f.matmul_T(H) * S.solve(numeric_matrix<2, 2>::identity());
+            const numeric_vector<3> x_a    = x_f + K * (z - H * x_f);
+            const numeric_matrix<3, 3> P_a = (numeric_matrix<3, 3>::identity() - K * H) * P_f;
+
+            enkf.update(z);
+            assert(enkf.state_vector().float_equals(x_a, 1e-9));
+            assert(enkf.covariance().float_equals(P_a, 1e-9));
+        }
+    }
+
+    // Lorenz-96, 40 states tracked with 30 members, half of the states observed
+    numeric_vector<n> truth;
+    for (size_t i = 0; i < n; ++i) truth[i] = 8 + (i == 0 ? 0.01 : 0.);
+    for (size_t k = 0; k < 500; ++k) truth = l96(truth, {});
+
+    const numeric_matrix<n, n> Q         = numeric_matrix<n, n>::diagonals(1e-4);
+    const numeric_matrix<n / 2, n / 2> R = numeric_matrix<n / 2, n / 2>::diagonals(0.25);
+    numeric_vector<n> guess, sigma;
+    for (size_t i = 0; i < n; ++i) {
+        guess[i] = 8;
+        sigma[i] = 2;
+    }
+    auto enkf = make_ensemble_kalman_filter<n, n / 2, 1, 30>(l96, l96_h, Q, R, guess, sigma, 11);
+    enkf.set_inflation(1.05);
+    numeric_vector<n> free_run = guess;
+
+    real_t err_enkf = 0, err_free = 0;
+    for (size_t k = 0; k < 400; ++k) {
+        truth    = l96(truth, {});
+        free_run = l96(free_run, {});
+        numeric_vector<n / 2> z = l96_h(truth);
+        for (size_t i = 0; i < n / 2; ++i) z[i] += (static_cast<real_t>((k + i) % 5) - 2) * 0.25;
+        enkf << z;
+        if (k >= 300) {
+            for (size_t i = 0; i < n; ++i) {
+                err_enkf += abs(enkf.state_vector()[i] - truth[i]);
+                err_free += abs(free_run[i] - truth[i]);
+            }
+        }
+    }
+    err_enkf /= 100 * n;
+    err_free /= 100 * n;
+    assert(err_enkf < 0.1 && err_enkf < err_free);
+
+    std::cout << "Lorenz-96 mean abs error, ETKF: " << err_enkf << ", free run: " << err_free << '\n';
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+template<size_t Row, size_t Col>
+bool near(const numeric_matrix<Row, Col> &A, const numeric_matrix<Row, Col> &B, real_t tol = 1e-9) {
+    for (size_t i = 0; i < Row; ++i)
+        if (!A[i].float_equals(B[i], tol)) return false;
+    return true;
+}
+
+int main() {
+    // Linear solve with pivoting (zero leading entry)
+    numeric_matrix<3> A({{0, 2, 1},
+                         {1, 1, 0},
+                         {3, 0, 1}});
+    numeric_vector<3> b({3, 2, 4});
+    numeric_vector<3> x = A.solve(b);
+    assert((A * x).float_equals(b));
+    assert(near(A * A.solve(numeric_matrix<3>::identity()), numeric_matrix<3>::identity()));
+
+    // Singularity is judged relative to the entries: tiny but well-conditioned solves, singular gives NaN
+    const numeric_matrix<3> A_small = A * 1e-17;
+    const numeric_vector<3> x_small = A_small.solve(b);
+    assert((x_small * 1e-17).float_equals(x, 1e-9));
+    const numeric_matrix<3> A_singular({{1, 2, 3},
+                                        {2, 4, 6},
+                                        {1, 0, 1}});
+    const numeric_vector<3> x_singular = A_singular.solve(b);
+    for (size_t i = 0; i < 3; ++i) assert(isnan(x_singular[i]));
+
+    // Exponential of diagonal and rotation generator
+    assert(near(expm(make_diagonal_matrix({0, 1, -2})), make_diagonal_matrix({1, exp(1.), exp(-2.)})));
+
+    const real_t w = 3.0;
+    numeric_matrix<2> Rot({{0, -w},
+                           {w, 0}});
+    assert(near(Rot.expm(), make_numeric_matrix({{cos(w), -sin(w)},
+                                                 {sin(w), cos(w)}}),
+                1e-12));
+
+    // Integrator chain: e^(A dt) equals the Taylor table of vdt
+    const real_t dt = 0.37;
+    vdt<4> v(dt);
+    assert(near(expm(vdt<4>::generate_A() * dt), v.generate_F(), 1e-12));
+
+    // Van Loan for constant velocity model against the closed form
+    const real_t q = 2.5;
+    auto cv        = vdt<1>(dt).generate_model(q);
+    assert(near(cv.F, make_numeric_matrix({{1, dt},
+                                           {0, 1}}),
+                1e-12));
+    assert(near(cv.Q, q * make_numeric_matrix({{dt * dt * dt / 3, dt * dt / 2},
+                                               {dt * dt / 2, dt}}),
+                1e-12));
+
+    // Constant acceleration model
+    auto ca          = vdt<2>(dt).generate_model(q);
+    const real_t dt2 = dt * dt, dt3 = dt2 * dt, dt4 = dt3 * dt, dt5 = dt4 * dt;
+    assert(near(ca.Q, q * make_numeric_matrix({{dt5 / 20, dt4 / 8, dt3 / 6},
+                                               {dt4 / 8, dt3 / 3, dt2 / 2},
+                                               {dt3 / 6, dt2 / 2, dt}}),
+                1e-12));
+
+    std::cout << "expm and Van Loan discretization passed\n";
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.1;
+
+using model_t = policy::linear_model_t<4, 2, 1>;
+
+using joseph_t    = kalman_filter_core_t<model_t, policy::bound_noise_t<4, 2>, policy::no_adaptation_t, policy::joseph_update_t>;
+using scalar_t    = kalman_filter_core_t<model_t, policy::bound_noise_t<4, 2>, policy::no_adaptation_t, policy::sequential_update_t>;
+using ema_owned_t = kalman_filter_core_t<model_t, policy::owned_noise_t<4, 2>, policy::ema_adaptation_t, policy::standard_update_t>;
+using windowed_t  = kalman_filter_core_t<model_t, policy::owned_noise_t<4, 2>,
+                                         policy::windowed_adaptation_t<4, 2, 200>, policy::standard_update_t>;
+
+const numeric_matrix<4, 4> F({{1, dt, 0, 0},
+                              {0, 1, 0, 0},
+                              {0, 0, 1, dt},
+                              {0, 0, 0, 1}});
+const numeric_matrix<2, 4> H({{1, 0, 0, 0},
+                              {0, 0, 1, 0}});
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) { return F * x; }
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) { return F; }
+
+numeric_vector<2> h(const numeric_vector<4> &x) { return H * x; }
+
+numeric_matrix<2, 4> Hj(const numeric_vector<4> &) { return H; }
+
+using ekf_joseph_t = kalman_filter_core_t<policy::extended_model_t<4, 2, 1>, policy::owned_noise_t<4, 2>,
+                                          policy::no_adaptation_t, policy::joseph_update_t>;
+
+int main() {
+    const numeric_matrix<4, 1> B = {};
+    const numeric_vector<4> q_sd = make_numeric_vector({0.01, 0.03, 0.01, 0.03});
+    numeric_matrix<4, 4> Q;
+    for (size_t i = 0; i < 4; ++i) Q[i][i] = q_sd[i] * q_sd[i];
+    const numeric_matrix<2, 2> R     = numeric_matrix<2, 2>::diagonals(0.04);
+    const numeric_matrix<2, 2> R_bad = numeric_matrix<2, 2>::diagonals(1.);
+    const numeric_vector<4> x0       = make_numeric_vector({0., 1., 0., 0.5});
+
+    kalman_filter_t<4, 2, 1> kf_std(F, B, H, Q, R, x0);
+    kalman_filter_t<4, 2, 1> kf_seq(F, B, H, Q, R, x0);
+    kf_std.set_sequential(false);
+    joseph_t kf_joseph(F, B, H, Q, R, x0);
+    scalar_t kf_scalar(F, B, H, Q, R, x0);
+    extended_kalman_filter_t<4, 2, 1> ekf(f, Fj, h, Hj, Q, R, x0);
+    ekf_joseph_t ekf_joseph(f, Fj, h, Hj, Q, R, x0);
+    ekf.set_sequential(false);
+    assert(kf_seq.is_sequential() && kf_scalar.is_sequential() && !kf_joseph.is_sequential());
+
+    // EMA adaptation on the caller's matrices and on private copies gives the same estimates
+    numeric_matrix<4, 4> Q_shared = Q;
+    numeric_matrix<2, 2> R_shared = R;
+    adaptive_kalman_filter_t<4, 2, 1> akf(F, B, H, Q_shared, R_shared, x0, 0.01, 0.01);
+    ema_owned_t akf_owned(F, B, H, Q, R, x0, 0.01, 0.01);
+
+    // Windowed covariance matching recovers R from a start 25 times too large
+    windowed_t wkf(F, B, H, Q, R_bad, x0, 1., 0.);
+
+    xorshift_t rng(23);
+    numeric_vector<4> truth = x0;
+    for (size_t k = 0; k < 2000; ++k) {
+        truth = F * truth;
+        for (size_t i = 0; i < 4; ++i) truth[i] += rng.normal(0, q_sd[i]);
+        const numeric_vector<2> z({truth[0] + rng.normal(0, 0.2), truth[2] + rng.normal(0, 0.2)});
+
+        kf_std << z;
+        kf_seq << z;
+        kf_joseph << z;
+        kf_scalar << z;
+        ekf << z;
+        ekf_joseph << z;
+        akf << z;
+        akf_owned << z;
+        wkf << z;
+
+        // Update forms agree, the Joseph form on linear and extended models alike
+        assert(kf_joseph.state_vector.float_equals(kf_std.state_vector, 1e-9));
+        assert(kf_joseph.covariance().float_equals(kf_std.covariance(), 1e-9));
+        assert(kf_scalar.state_vector.float_equals(kf_seq.state_vector, 0));
+        assert(kf_scalar.state_vector.float_equals(kf_std.state_vector, 1e-9));
+        assert(ekf_joseph.state_vector.float_equals(kf_joseph.state_vector, 1e-9));
+        assert(ekf.covariance().float_equals(kf_std.covariance(), 1e-9));
+
+        assert(akf_owned.state_vector.float_equals(akf.state_vector, 0));
+        assert(akf_owned.measurement_noise().float_equals(R_shared, 0));
+    }
+
+    // Shared storage adapts the caller's matrices, owned storage leaves them alone
+    assert(&akf.process_noise() == &Q_shared && !R_shared.float_equals(R, 1e-6));
+    assert(&akf_owned.process_noise() != &Q && akf.R.float_equals(R_shared, 0));
+
+    const numeric_matrix<2, 2> &R_est = wkf.measurement_noise();
+    assert(abs(R_est[0][0] - 0.04) < 0.01 && abs(R_est[1][1] - 0.04) < 0.01);
+    assert(abs(R_est[0][1]) < 0.01);
+    assert(wkf.process_noise().float_equals(Q, 0));
+
+    // Copies track their own state
+    kalman_filter_t<4, 2, 1> kf_copy(kf_std);
+    kf_copy.predict();
+    assert(&kf_copy.state_vector != &kf_std.state_vector && !kf_copy.state_vector.float_equals(kf_std.state_vector, 0));
+
+    std::cout << "Windowed R estimate: " << R_est[0][0] << ' ' << R_est[1][1] << ", true: 0.04\n";
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt    = 0.01;
+constexpr size_t lag   = 8;
+constexpr size_t steps = 80;
+
+int main() {
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<1, 3> H({{1, 0, 0}});
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(2.).Q + numeric_matrix<3, 3>::diagonals(1e-3);
+    const numeric_matrix<1, 1> R = numeric_matrix<1, 1>::diagonals(0.05);
+    const numeric_vector<3> x0   = {};
+
+    fixed_lag_smoother_t<3, 1, 1, lag> fls(F, B, H, Q, R, x0);
+    kalman_filter_t<3, 1, 1> kf(F, B, H, Q, R, x0);
+    real_t z[steps], truth[steps];
+    real_t err_f = 0, err_s = 0;
+
+    for (size_t k = 0; k < steps; ++k) {
+        const real_t t = static_cast<real_t>(k) * dt;
+        truth[k]       = 3 * t * t + t;
+        z[k]           = truth[k] + (static_cast<real_t>(k % 5) - 2) * 0.2;
+
+        fls << make_numeric_vector({z[k]});
+        kf.predict().update(z[k]);
+        assert(fls.state_vector().float_equals(kf.state_vector));
+        assert(fls.ready() == (k >= lag));
+
+        // Full RTS pass over the measurements so far, read back at the lagged step
+        const size_t j = k >= lag ? k - lag : 0;
+        kalman_filter_t<3, 1, 1> kf_ref(F, B, H, Q, R, x0);
+        rts_smoother_t<3, steps> rts;
+        for (size_t i = 0; i <= k; ++i) rts.record(kf_ref, z[i]);
+        rts.smooth();
+        assert(fls.smoothed_state().float_equals(rts.state(j), 1e-9));
+
+        if (fls.ready()) {
+            err_f += abs(rts.state(k)[0] - truth[k]);
+            err_s += abs(fls.smoothed_state()[0] - truth[j]);
+        }
+    }
+    assert(err_s < err_f);
+
+    // Window keeps only the newest steps
+    circular_buffer_static_t<int, 3> buf;
+    for (int i = 0; i < 5; ++i) buf.push_overwrite(i);
+    assert(buf.full() && buf.front() == 2 && buf[1] == 3 && buf.back() == 4);
+    buf.clear();
+    assert(buf.empty());
+
+    std::cout << "Mean abs error filtered: " << err_f / (steps - lag) << ", lag-" << lag << " smoothed: " << err_s / (steps - lag) << '\n';
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.01;
+
+using accel_t = sensor_model_t<3, 1, struct accel_tag>;
+using gps_t   = sensor_model_t<3, 2, struct gps_tag>;
+using baro_t  = sensor_model_t<3, 1, struct baro_tag>;
+
+// Dense update with an explicit inverse
+template<size_t N, size_t M>
+void reference_update(numeric_vector<N> &x, numeric_matrix<N, N> &P,
+                      const numeric_matrix<M, N> &H, const numeric_matrix<M, M> &R, const numeric_vector<M> &z) {
+    const numeric_matrix<M, M> S = H * P.matmul_T(H) + R;
+    const numeric_matrix<N, M> K = P.matmul_T(H) * S.solve(numeric_matrix<M, M>::identity());
+    x += K * (z - H * x);
+    P = (numeric_matrix<N, N>::identity() - K * H) * P;
+}
+
+int main() {
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(1.).Q + numeric_matrix<3, 3>::diagonals(1e-4);
+    const numeric_vector<3> x0   = {};
+
+    const numeric_matrix<1, 3> H_acc({{0, 0, 1}});
+    const numeric_matrix<1, 1> R_acc = numeric_matrix<1, 1>::diagonals(0.1);
+    const numeric_matrix<2, 3> H_gps({{1, 0, 0},
+                                      {0, 1, 0}});
+    const numeric_matrix<2, 2> R_gps({{0.5, 0.1},
+                                      {0.1, 0.3}});
+    const numeric_matrix<1, 3> H_baro({{1, 0, 0}});
+    const numeric_matrix<1, 1> R_baro = numeric_matrix<1, 1>::diagonals(0.2);
+
+    const accel_t accel(H_acc, R_acc);
+    const gps_t gps(H_gps, R_gps);
+    const baro_t baro(H_baro, R_baro);
+    assert(accel.is_sequential() && !gps.is_sequential());
+
+    fusion_kalman_filter_t<3, 1, accel_t, gps_t, baro_t> fkf(F, B, Q, x0, accel, gps, baro);
+    assert(fkf.sensor_count() == 3);
+    assert(&fkf.sensor<gps_t>().H() == &H_gps);
+
+    // All sensors each step match one filter with the stacked measurement model
+    const numeric_matrix<4, 3> H_all({{0, 0, 1},
+                                      {1, 0, 0},
+                                      {0, 1, 0},
+                                      {1, 0, 0}});
+    const numeric_matrix<4, 4> R_all({{0.1, 0, 0, 0},
+                                      {0, 0.5, 0.1, 0},
+                                      {0, 0.1, 0.3, 0},
+                                      {0, 0, 0, 0.2}});
+    kalman_filter_t<3, 4, 1> kf_all(F, B, H_all, Q, R_all, x0);
+    kf_all.set_sequential(false);
+
+    for (size_t k = 0; k < 200; ++k) {
+        const real_t t     = static_cast<real_t>(k) * dt;
+        const real_t noise = (static_cast<real_t>(k % 5) - 2) * 0.05;
+        const real_t p = t * t, v = 2 * t, a = 2;
+        fkf.predict().update<accel_t>(make_numeric_vector({a + noise}));
+        fkf.update<gps_t>(make_numeric_vector({p - noise, v + noise}));
+        fkf.update<baro_t>(make_numeric_vector({p + 2 * noise}));
+        kf_all.predict().update(make_numeric_vector({a + noise, p - noise, v + noise, p + 2 * noise}));
+        assert(fkf.state_vector().float_equals(kf_all.state_vector, 1e-9));
+    }
+
+    // Sensors at different rates match dense per-sensor updates
+    fusion_kalman_filter_t<3, 1, accel_t, gps_t, baro_t> fkf_rates(F, B, Q, x0, accel, gps, baro);
+    numeric_vector<3> x = x0;
+    numeric_matrix<3, 3> P = Q;
+    for (size_t k = 0; k < 500; ++k) {
+        const real_t t     = static_cast<real_t>(k) * dt;
+        const real_t noise = (static_cast<real_t>(k % 7) - 3) * 0.05;
+        fkf_rates.predict();
+        x = F * x;
+        P = F * P.matmul_T(F) + Q;
+
+        const numeric_vector<1> z_acc = make_numeric_vector({2 + noise});
+        fkf_rates.update<accel_t>(z_acc);
+        reference_update(x, P, H_acc, R_acc, z_acc);
+        if (k % 10 == 0) {
+            const numeric_vector<2> z_gps = make_numeric_vector({t * t + noise, 2 * t - noise});
+            fkf_rates.update<gps_t>(z_gps);
+            reference_update(x, P, H_gps, R_gps, z_gps);
+        }
+        if (k % 4 == 0) {
+            const numeric_vector<1> z_baro = make_numeric_vector({t * t - noise});
+            fkf_rates.update<baro_t>(z_baro);
+            reference_update(x, P, H_baro, R_baro, z_baro);
+        }
+        assert(fkf_rates.state_vector().float_equals(x, 1e-9));
+        assert(fkf_rates.covariance().float_equals(P, 1e-9));
+    }
+
+    std::cout << "Fused state: ";
+    for (auto &s: fkf_rates.state_vector()) std::cout << s << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
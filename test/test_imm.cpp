@@ -0,0 +1,76 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.05;
+
+int main() {
+    // Constant velocity embedded in the (p, v, a) state of the constant acceleration model
+    const numeric_matrix<3, 3> F[2] = {numeric_matrix<3, 3>({{1, dt, 0},
+                                                             {0, 1, 0},
+                                                             {0, 0, 0}}),
+                                       vdt<2>(dt).generate_F()};
+    const numeric_matrix<2, 2> Q_cv = vdt<1>(dt).generate_model(0.01).Q;
+    const numeric_matrix<3, 3> Q[2] = {numeric_matrix<3, 3>({{Q_cv[0][0], Q_cv[0][1], 0},
+                                                             {Q_cv[1][0], Q_cv[1][1], 0},
+                                                             {0, 0, 0}}),
+                                       vdt<2>(dt).generate_model(20.).Q};
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<1, 3> H({{1, 0, 0}});
+    const numeric_matrix<1, 1> R = numeric_matrix<1, 1>::diagonals(0.01);
+    const numeric_matrix<2, 2> Pi({{0.95, 0.05},
+                                   {0.05, 0.95}});
+    const numeric_vector<3> x0   = {};
+    const numeric_vector<2> mu0({0.5, 0.5});
+
+    // A single model reduces to the Kalman filter
+    {
+        const numeric_matrix<3, 3> F1[1] = {F[1]};
+        const numeric_matrix<3, 3> Q1[1] = {Q[1]};
+        const numeric_matrix<1, 1> Pi1   = numeric_matrix<1, 1>::diagonals(1.);
+        imm_filter_t<3, 1, 1, 1> imm1(F1, Q1, B, H, R, Pi1, x0, make_numeric_vector({1.}));
+        kalman_filter_t<3, 1, 1> kf(F[1], B, H, Q[1], R, x0);
+        kf.set_sequential(false);
+        for (size_t k = 0; k < 100; ++k) {
+            const real_t t = static_cast<real_t>(k) * dt;
+            imm1 << make_numeric_vector({t * t});
+            kf << make_numeric_vector({t * t});
+            assert(imm1.state_vector().float_equals(kf.state_vector, 1e-9));
+            assert(imm1.covariance().float_equals(kf.covariance(), 1e-9));
+        }
+    }
+
+    // Cruise, then a hard maneuver, then cruise again
+    imm_filter_t<3, 1, 1, 2> imm(F, Q, B, H, R, Pi, x0, mu0);
+    kalman_filter_t<3, 1, 1> kf_cv(F[0], B, H, Q[0], R, x0);
+    kalman_filter_t<3, 1, 1> kf_ca(F[1], B, H, Q[1], R, x0);
+    real_t p = 0, v = 1, a = 0;
+    real_t err_imm = 0, err_cv = 0, err_ca = 0;
+    for (size_t k = 0; k < 300; ++k) {
+        a = (k >= 100 && k < 160) ? (k < 130 ? 6. : -6.) : 0.;
+        p += v * dt + 0.5 * a * dt * dt;
+        v += a * dt;
+        const real_t z = p + (static_cast<real_t>(k % 5) - 2) * 0.05;
+
+        imm << make_numeric_vector({z});
+        kf_cv << make_numeric_vector({z});
+        kf_ca << make_numeric_vector({z});
+
+        const numeric_vector<2> &mu = imm.mode_probabilities();
+        assert(abs(mu[0] + mu[1] - 1) < 1e-12 && mu[0] >= 0 && mu[1] >= 0);
+        if (k == 95) assert(mu[0] > 0.5);
+        if (k == 125) assert(mu[1] > 0.5);
+        if (k == 295) assert(mu[0] > 0.5);
+
+        err_imm += abs(imm.state_vector()[1] - v);
+        err_cv += abs(kf_cv.state_vector[1] - v);
+        err_ca += abs(kf_ca.state_vector[1] - v);
+    }
+    assert(err_imm < err_cv && err_imm < err_ca);
+
+    std::cout << "Mean abs velocity error IMM: " << err_imm / 300 << ", CV: " << err_cv / 300 << ", CA: " << err_ca / 300 << '\n';
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.02;
+
+int main() {
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B({{0}, {0}, {1}});
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(0.5).Q + numeric_matrix<3, 3>::diagonals(1e-6);
+    const numeric_vector<3> x0({0, 1, 0});
+
+    // Six redundant sensors stacked into one measurement (M > N)
+    const numeric_matrix<6, 3> H({{1, 0, 0},
+                                  {1, 0, 0},
+                                  {0, 1, 0},
+                                  {0, 1, 0.1},
+                                  {0, 0, 1},
+                                  {1, 1, 0}});
+    const numeric_matrix<6, 6> R = make_diagonal_matrix({0.04, 0.09, 0.01, 0.02, 0.25, 0.1});
+
+    kalman_filter_t<3, 6, 1> kf(F, B, H, Q, R, x0);
+    information_filter_t<3, 6, 1> inf(F, B, H, Q, R, x0);
+
+    // Same sensors fused one at a time as separate contributions
+    const numeric_matrix<2, 3> H_a({{1, 0, 0},
+                                    {1, 0, 0}});
+    const numeric_matrix<2, 2> R_a = make_diagonal_matrix({0.04, 0.09});
+    const numeric_matrix<4, 3> H_b({{0, 1, 0},
+                                    {0, 1, 0.1},
+                                    {0, 0, 1},
+                                    {1, 1, 0}});
+    const numeric_matrix<4, 4> R_b = make_diagonal_matrix({0.01, 0.02, 0.25, 0.1});
+    information_filter_t<3, 2, 1> inf_split(F, B, H_a, Q, R_a, x0);
+
+    const numeric_vector<1> u({0.3});
+    for (int k = 0; k < 300; ++k) {
+        const real_t t = k * dt;
+        const real_t p = t + 0.15 * t * t;
+        const real_t v = 1 + 0.3 * t;
+        const real_t n = ((k % 7) - 3) * 0.02;
+        const numeric_vector<6> z({p + n, p - n, v + n, v + 0.03 - n, 0.3 + n, p + v});
+
+        kf.predict(u).update(z);
+        inf.predict(u).update(z);
+        assert(inf.state_vector().float_equals(kf.state_vector, 1e-8));
+
+        inf_split.predict(u)
+                .update(make_numeric_vector({z[0], z[1]}))
+                .update(H_b, R_b, make_numeric_vector({z[2], z[3], z[4], z[5]}));
+        assert(inf_split.state_vector().float_equals(kf.state_vector, 1e-8));
+    }
+
+    // Covariance recovered from the information matrix
+    assert((inf.covariance() * inf.information_matrix()).float_equals(numeric_matrix<3, 3>::identity(), 1e-8));
+
+    std::cout << "Information filter state: ";
+    for (auto &x: inf.state_vector()) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+int main() {
+    constexpr real_t q                = 0.5;
+    constexpr real_t periods[]        = {0.02, 0.01, 0.015, 0.005};
+    const numeric_matrix<3, 3> A      = vdt<2>::generate_A();
+    const numeric_matrix<3, 1> G      = make_numeric_matrix<3, 1>({{0}, {0}, {1}});
+    const numeric_matrix<1, 1> Qc     = numeric_matrix<1, 1>::diagonals(q);
+    const numeric_matrix<1, 3> H      = make_numeric_matrix<1, 3>({{1, 0, 0}});
+    const numeric_matrix<1, 1> R      = numeric_matrix<1, 1>::diagonals(0.1);
+    const numeric_matrix<3, 1> B      = {};
+    const numeric_vector<3> x0        = {};
+
+    kalman_lut_t<3, 1, 4> lut(periods, A, G, Qc);
+    lut.precompute_gain(H, R);
+
+    // Buckets are sorted and match direct discretization
+    assert(lut.has_gain());
+    for (size_t i = 1; i < lut.size(); ++i) assert(lut[i - 1].dt < lut[i].dt);
+    for (size_t i = 0; i < lut.size(); ++i) {
+        auto model = vdt<2>(lut[i].dt).generate_model(q);
+        assert(lut[i].F.float_equals(model.F));
+        assert(lut[i].Q.float_equals(model.Q));
+    }
+
+    // Nearest-bucket lookup
+    assert(lut.nearest(0.0).dt == 0.005);
+    assert(lut.nearest(0.011).dt == 0.01);
+    assert(lut.nearest(0.0126).dt == 0.015);
+    assert(lut.nearest(1.0).dt == 0.02);
+
+    // Interpolation hits buckets exactly and lies between them otherwise
+    numeric_matrix<3, 3> F_i, Q_i;
+    lut.interpolate(0.01, F_i, Q_i);
+    assert(F_i.float_equals(lut[1].F) && Q_i.float_equals(lut[1].Q));
+    lut.interpolate(0.0125, F_i, Q_i);
+    assert(abs(F_i[0][1] - 0.0125) < 1e-12);
+
+    // Generator-based table
+    kalman_lut_t<3, 1, 4> lut_gen(periods, [&](const real_t &dt) { return vdt<2>(dt).generate_model(q); });
+    assert(lut_gen[3].Q.float_equals(lut[3].Q));
+
+    // Steady-state gain reproduces the converged time-varying filter
+    kalman_filter_t<3, 1, 1> kf_tv(lut[1].F, B, H, lut[1].Q, R, x0);
+    numeric_vector<3> x_ss = x0;
+    for (int k = 0; k < 3000; ++k) {
+        const real_t z = 0.01 * k + ((k % 7) - 3) * 0.05;
+        kf_tv.predict().update(z);
+        x_ss = lut[1].F * x_ss;
+        x_ss += lut[1].K * (make_numeric_vector({z}) - H * x_ss);
+    }
+    assert(kf_tv.state_vector.float_equals(x_ss, 1e-8));
+
+    // Pointer swap matches a filter bound to freshly built matrices
+    kalman_filter_t<3, 1, 1> kf_lut(lut[0].F, B, H, lut[0].Q, R, x0);
+    numeric_matrix<3, 3> F_ref = lut[0].F, Q_ref = lut[0].Q;
+    kalman_filter_t<3, 1, 1> kf_ref(F_ref, B, H, Q_ref, R, x0);
+
+    const real_t jitter[] = {0.0101, 0.0049, 0.0152, 0.0198, 0.0099, 0.0148};
+    real_t t              = 0;
+    for (size_t k = 0; k < 60; ++k) {
+        const real_t dt = jitter[k % 6];
+        t += dt;
+        const real_t z = 2. * t * t + 0.3 * t;
+
+        const auto &entry = lut.apply(kf_lut, dt);
+        auto model        = vdt<2>(entry.dt).generate_model(q);
+        F_ref             = model.F;
+        Q_ref             = model.Q;
+
+        kf_lut.predict().update(z);
+        kf_ref.predict().update(z);
+        assert(kf_lut.state_vector.float_equals(kf_ref.state_vector, 1e-8));
+    }
+
+    // Implicit Toeplitz propagation matches the materialized F
+    vdt<3> v(0.037);
+    const numeric_matrix<4, 4> F4 = v.generate_F();
+    numeric_vector<4> x4({1, -2, 0.5, 3});
+    numeric_matrix<4, 4> P4;
+    for (size_t i = 0; i < 4; ++i)
+        for (size_t j = 0; j < 4; ++j) P4[i][j] = 1. / static_cast<real_t>(i + j + 1);
+    const numeric_vector<4> x4_ref    = F4 * x4;
+    const numeric_matrix<4, 4> P4_ref = F4 * P4.matmul_T(F4);
+    v.propagate(x4);
+    v.propagate_covariance(P4);
+    assert(x4.float_equals(x4_ref, 1e-12));
+    assert(P4.float_equals(P4_ref, 1e-12));
+
+    // kf_pos with variable dt matches a dense filter rebuilt each step
+    kf_pos<3> tracker(0.01, 0.1, 0., 0.);
+    numeric_matrix<3, 3> F_dense = tracker.ivdt.generate_F();
+    kalman_filter_t<3, 1, 1> kf_dense(F_dense, tracker.B, tracker.H, tracker.Q, tracker.R, x0);
+    t = 0;
+    for (size_t k = 0; k < 60; ++k) {
+        const real_t dt = jitter[k % 6];
+        t += dt;
+        tracker.update_dt(dt);
+        F_dense = vdt<2>(dt).generate_F();
+        if (k % 2 == 0) tracker.predict().update(t * t);
+        else tracker.kf.predict().update(t * t);
+        kf_dense.predict().update(t * t);
+        assert(tracker.kf.transition().float_equals(F_dense, 0));
+        assert(tracker.kf.state_vector.float_equals(kf_dense.state_vector, 1e-9));
+    }
+
+    std::cout << "Estimated acceleration: " << kf_lut.state_vector[2] << '\n';
+    std::cout << "Steady-state gain (dt = " << lut[1].dt << "): ";
+    for (size_t i = 0; i < 3; ++i) std::cout << lut[1].K[i][0] << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
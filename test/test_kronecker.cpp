@@ -0,0 +1,105 @@
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt               = 0.1;
+constexpr real_t hdts             = 0.5 * dt * dt;
+constexpr real_t base_noise_value = 0.001;
+
+int main() {
+    // Kronecker product
+    numeric_matrix<2, 3> A({{1, 2, 3},
+                            {4, 5, 6}});
+    numeric_matrix<2, 2> B({{0, 1},
+                            {-1, 2}});
+    auto AB  = make_kron(A, B);
+    auto ABd = kron(A, B);
+    assert(ABd[0][1] == 1 && ABd[1][0] == -1 && ABd[3][5] == 12 && ABd[2][4] == 0);
+    for (size_t i = 0; i < AB.r(); ++i)
+        for (size_t j = 0; j < AB.c(); ++j) assert(AB(i, j) == ABd[i][j]);
+
+    numeric_vector<6> v({1, -1, 2, 0.5, 3, -2});
+    assert((AB * v).float_equals(ABd * v));
+
+    // Dense interleaved 3-axis model from the 3-dimension tracking example
+    const numeric_matrix<9, 9> F({{1, 0, 0, dt, 0, 0, hdts, 0, 0},
+                                  {0, 1, 0, 0, dt, 0, 0, hdts, 0},
+                                  {0, 0, 1, 0, 0, dt, 0, 0, hdts},
+                                  {0, 0, 0, 1, 0, 0, dt, 0, 0},
+                                  {0, 0, 0, 0, 1, 0, 0, dt, 0},
+                                  {0, 0, 0, 0, 0, 1, 0, 0, dt},
+                                  {0, 0, 0, 0, 0, 0, 1, 0, 0},
+                                  {0, 0, 0, 0, 0, 0, 0, 1, 0},
+                                  {0, 0, 0, 0, 0, 0, 0, 0, 1}});
+    const numeric_matrix<9, 1> B9;
+    const numeric_matrix<3, 9> H({{1},
+                                  {0, 1},
+                                  {0, 0, 1}});
+    const numeric_matrix<9, 9> Q = numeric_matrix<9, 9>::diagonals(base_noise_value);
+    const numeric_matrix<3, 3> R = numeric_matrix<3, 3>::diagonals(base_noise_value);
+    const numeric_vector<9> x0;
+
+    // Recognize decoupled axes and extract per-axis factors
+    numeric_matrix<3, 3> F1, Q1;
+    numeric_matrix<1, 3> H1;
+    numeric_matrix<1, 1> R1;
+    const numeric_matrix<3, 1> B1;
+    [[maybe_unused]] const bool F_separable = kron_identity_factor<3>(F, F1);
+    [[maybe_unused]] const bool H_separable = kron_identity_factor<3>(H, H1);
+    [[maybe_unused]] const bool Q_separable = kron_identity_factor<3>(Q, Q1);
+    [[maybe_unused]] const bool R_separable = kron_identity_factor<3>(R, R1);
+    assert(F_separable && H_separable && Q_separable && R_separable);
+    assert(kron(F1, numeric_matrix<3>::identity()) == F);
+
+    numeric_matrix<3, 3> scratch;
+    [[maybe_unused]] const bool coupled_separable = kron_identity_factor<3>(numeric_matrix<9, 9>(1.), scratch);
+    assert(!coupled_separable);
+
+    kalman_filter_t<9, 3, 1> kf(F, B9, H, Q, R, x0);
+    separable_kalman_filter_t<3, 3, 1, 1> skf(F1, B1, H1, Q1, R1, x0);
+
+    for (int k = 0; k < 200; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<3> z({t * t, 2 * t - 1, 0.5 * t * t * t * 0.01});
+        kf.predict().update(z);
+        skf.predict().update(z);
+        assert(skf.state_vector().float_equals(kf.state_vector, 1e-9));
+    }
+
+    assert(skf.axis_state(1).float_equals(make_numeric_vector({skf.state_vector()[1],
+                                                               skf.state_vector()[4],
+                                                               skf.state_vector()[7]})));
+    assert(skf.covariance().a().float_equals(skf.axis_covariance()));
+
+    // Small noise makes det S tiny, the gain must still follow the per-axis filter
+    const numeric_matrix<2, 2> F_cv({{1, dt},
+                                     {0, 1}});
+    const numeric_matrix<2, 1> B_cv;
+    const numeric_matrix<2, 2> H_cv = numeric_matrix<2, 2>::identity();
+    const numeric_matrix<2, 2> Q_cv = numeric_matrix<2, 2>::diagonals(1e-6);
+    const numeric_matrix<2, 2> R_cv = numeric_matrix<2, 2>::diagonals(1e-6);
+    separable_kalman_filter_t<2, 2, 2, 1> skf_small(F_cv, B_cv, H_cv, Q_cv, R_cv, {});
+    kalman_filter_t<2, 2, 1> kf_x(F_cv, B_cv, H_cv, Q_cv, R_cv, {});
+    kalman_filter_t<2, 2, 1> kf_y(F_cv, B_cv, H_cv, Q_cv, R_cv, {});
+    kf_x.set_sequential(false);
+    kf_y.set_sequential(false);
+    for (int k = 0; k < 20; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<4> z({1 + t, 2 - t, 3, 4});
+        skf_small.predict().update(z);
+        kf_x.predict().update(z[0], z[2]);
+        kf_y.predict().update(z[1], z[3]);
+        assert(skf_small.axis_state(0).float_equals(kf_x.state_vector, 1e-9));
+        assert(skf_small.axis_state(1).float_equals(kf_y.state_vector, 1e-9));
+    }
+    assert(skf_small.state_vector()[0] > 0.5);
+
+    std::cout << "Separable state: ";
+    for (auto &x: skf.state_vector()) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
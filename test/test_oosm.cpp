@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t fast_dt   = 0.01;
+constexpr real_t slow_dt   = 0.05;
+constexpr size_t n_fast    = 2000;
+constexpr size_t n_repeats = 20;
+
+struct measurement_t {
+    real_t t;        // time of validity
+    real_t arrival;  // time of arrival
+    real_t z;
+};
+
+discrete_model_t<2> model(const real_t &dt) { return vdt<1>(dt).generate_model(0.5); }
+
+real_t truth(const real_t &t) { return sin(t) + 0.5 * t; }
+
+// Fast sensor arrives on time, slow sensor arrives delay late
+std::vector<measurement_t> make_stream(const real_t &slow_offset, const real_t &delay) {
+    std::vector<measurement_t> stream;
+    for (size_t k = 1; k <= n_fast; ++k) {
+        const real_t t = static_cast<real_t>(k) * fast_dt;
+        stream.push_back({t, t, truth(t) + (static_cast<real_t>(k % 5) - 2) * 0.02});
+    }
+    for (size_t k = 1; k * slow_dt + slow_offset < n_fast * fast_dt - delay; ++k) {
+        const real_t t = static_cast<real_t>(k) * slow_dt + slow_offset;
+        stream.push_back({t, t + delay, truth(t) + (static_cast<real_t>(k % 3) - 1) * 0.02});
+    }
+    std::stable_sort(stream.begin(), stream.end(), [](const measurement_t &a, const measurement_t &b) { return a.arrival < b.arrival; });
+    return stream;
+}
+
+template<typename Filter>
+void run_arrival_order(Filter &filter, const std::vector<measurement_t> &stream) {
+    for (const auto &m: stream) {
+        [[maybe_unused]] const bool accepted = filter.update(m.t, make_numeric_vector({m.z}));
+        assert(accepted);
+    }
+}
+
+// Holds every measurement back until the slowest sensor has reported, then processes in time order
+template<typename Filter>
+real_t run_hold_back(Filter &filter, const std::vector<measurement_t> &stream, const real_t &delay) {
+    std::vector<measurement_t> pending;
+    real_t max_lag = 0;
+    for (const auto &m: stream) {
+        pending.push_back(m);
+        std::sort(pending.begin(), pending.end(), [](const measurement_t &a, const measurement_t &b) { return a.t < b.t; });
+        size_t released = 0;
+        while (released < pending.size() && pending[released].t <= m.arrival - delay) {
+            [[maybe_unused]] const bool accepted = filter.update(pending[released].t, make_numeric_vector({pending[released].z}));
+            assert(accepted);
+            ++released;
+        }
+        pending.erase(pending.begin(), pending.begin() + static_cast<long>(released));
+        max_lag = m.arrival - filter.time() > max_lag ? m.arrival - filter.time() : max_lag;
+    }
+    for (const auto &m: pending) {
+        [[maybe_unused]] const bool accepted = filter.update(m.t, make_numeric_vector({m.z}));
+        assert(accepted);
+    }
+    return max_lag;
+}
+
+template<typename Run>
+real_t time_per_measurement(Run run, size_t measurements) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < n_repeats; ++r) run();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<real_t, std::micro>(stop - start).count() / static_cast<real_t>(n_repeats * measurements);
+}
+
+int main() {
+    const numeric_matrix<2, 1> B  = {};
+    const numeric_matrix<1, 2> H({{1, 0}});
+    const numeric_matrix<1, 1> R  = numeric_matrix<1, 1>::diagonals(0.01);
+    const numeric_vector<2> x0    = {};
+    const numeric_matrix<2, 2> P0 = numeric_matrix<2, 2>::diagonals(1.);
+
+    using filter_t = oosm_kalman_filter_t<2, 1, 1, 32>;
+
+    // Rejects measurements older than the history and predictions into the past
+    {
+        filter_t f(model, B, H, R, x0, P0);
+        [[maybe_unused]] const bool too_old  = f.update(-0.1, make_numeric_vector({0.}));
+        [[maybe_unused]] const bool forward  = f.predict(0.02);
+        [[maybe_unused]] const bool backward = f.predict(0.01);
+        [[maybe_unused]] const bool late     = f.update(0.01, make_numeric_vector({0.}));
+        assert(!too_old && forward && !backward && late);
+        assert(f.time() == 0.02 && f.size() == 3);
+    }
+
+    // Full history with a late measurement right after the oldest step: the late step becomes the oldest
+    {
+        oosm_kalman_filter_t<2, 1, 1, 4> f_late(model, B, H, R, x0, P0);
+        oosm_kalman_filter_t<2, 1, 1, 4> f_order(model, B, H, R, x0, P0);
+        for (const real_t t: {0.01, 0.02, 0.03}) f_late.update(t, make_numeric_vector({t}));
+        assert(f_late.size() == f_late.capacity());
+        [[maybe_unused]] const bool oldest = f_late.update(0.005, make_numeric_vector({0.005}));
+        for (const real_t t: {0.005, 0.01, 0.02, 0.03}) f_order.update(t, make_numeric_vector({t}));
+        assert(oldest && f_late.size() == 4 && f_late.horizon() == 0.005 && f_late.time() == 0.03);
+        assert(f_late.state_vector().float_equals(f_order.state_vector(), 1e-9));
+        assert(f_late.covariance().float_equals(f_order.covariance(), 1e-9));
+    }
+
+    // Late measurements within the latest interval: retrodiction and rollback match in-order processing
+    {
+        const real_t delay                      = 0.005;
+        const std::vector<measurement_t> stream = make_stream(-0.003, delay);
+
+        filter_t f_rollback(model, B, H, R, x0, P0);
+        filter_t f_retro(model, B, H, R, x0, P0);
+        filter_t f_hold(model, B, H, R, x0, P0);
+        f_retro.set_retrodiction(true);
+
+        for (const auto &m: stream) {
+            const numeric_vector<1> z = make_numeric_vector({m.z});
+            [[maybe_unused]] const bool rolled_back = f_rollback.update(m.t, z);
+            [[maybe_unused]] const bool retrodicted = f_retro.update(m.t, z);
+            assert(rolled_back && retrodicted);
+            assert(f_retro.state_vector().float_equals(f_rollback.state_vector(), 1e-9));
+            assert(f_retro.covariance().float_equals(f_rollback.covariance(), 1e-9));
+        }
+        run_hold_back(f_hold, stream, delay);
+        assert(f_hold.state_vector().float_equals(f_rollback.state_vector(), 1e-9));
+
+        auto rollback = [&]() { filter_t f(model, B, H, R, x0, P0); run_arrival_order(f, stream); };
+        auto retro    = [&]() { filter_t f(model, B, H, R, x0, P0); f.set_retrodiction(true); run_arrival_order(f, stream); };
+        auto hold     = [&]() { filter_t f(model, B, H, R, x0, P0); run_hold_back(f, stream, delay); };
+        std::cout << "One-step lag, us per measurement: rollback " << time_per_measurement(rollback, stream.size())
+                  << ", retrodiction " << time_per_measurement(retro, stream.size())
+                  << ", hold back " << time_per_measurement(hold, stream.size()) << '\n';
+    }
+
+    // 200 ms latency spans many steps, retrodiction falls back to rollback
+    {
+        const real_t delay                      = 0.2;
+        const std::vector<measurement_t> stream = make_stream(0.002, delay);
+
+        auto f_rollback = make_oosm_kalman_filter<2, 1, 1, 32>([](const real_t &dt) { return vdt<1>(dt).generate_model(0.5); },
+                                                               B, H, R, x0, P0);
+        filter_t f_retro(model, B, H, R, x0, P0);
+        filter_t f_hold(model, B, H, R, x0, P0);
+        f_retro.set_retrodiction(true);
+
+        run_arrival_order(f_rollback, stream);
+        run_arrival_order(f_retro, stream);
+        const real_t hold_lag = run_hold_back(f_hold, stream, delay);
+        assert(f_rollback.state_vector().float_equals(f_hold.state_vector(), 1e-9));
+        assert(f_rollback.covariance().float_equals(f_hold.covariance(), 1e-9));
+        assert(f_retro.state_vector().float_equals(f_hold.state_vector(), 1e-9));
+        assert(hold_lag >= delay - fast_dt);
+        assert(abs(f_rollback.state_vector()[0] - truth(f_rollback.time())) < 0.05);
+
+        auto rollback = [&]() { filter_t f(model, B, H, R, x0, P0); run_arrival_order(f, stream); };
+        auto hold     = [&]() { filter_t f(model, B, H, R, x0, P0); run_hold_back(f, stream, delay); };
+        std::cout << "200 ms lag, us per measurement: rollback " << time_per_measurement(rollback, stream.size())
+                  << ", hold back " << time_per_measurement(hold, stream.size())
+                  << " (estimate delayed by up to " << hold_lag * 1000 << " ms)\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <chrono>
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt          = 0.01;
+constexpr size_t n_particles = 100000;
+constexpr size_t steps       = 100;
+constexpr real_t sigma_a     = 0.5;
+constexpr real_t sigma_b     = 0.01;
+
+// Two bearing-only sensors observe a target moving in the plane, state (x, y, vx, vy)
+const real_t obs_x[2] = {0, 20};
+const real_t obs_y[2] = {0, 0};
+
+void propagate(numeric_vector<4> &x, const numeric_vector<1> &, xorshift_t &rng) {
+    const real_t ax = sigma_a * rng.normal(), ay = sigma_a * rng.normal();
+    x[0] += dt * x[2] + 0.5 * dt * dt * ax;
+    x[1] += dt * x[3] + 0.5 * dt * dt * ay;
+    x[2] += dt * ax;
+    x[3] += dt * ay;
+}
+
+real_t wrap(real_t a) {
+    while (a > PI) a -= TWO_PI;
+    while (a < -PI) a += TWO_PI;
+    return a;
+}
+
+real_t log_likelihood(const numeric_vector<4> &x, const numeric_vector<2> &z) {
+    real_t l = 0;
+    for (size_t s = 0; s < 2; ++s) {
+        const real_t e = wrap(z[s] - atan2(x[1] - obs_y[s], x[0] - obs_x[s]));
+        l -= 0.5 * e * e / (sigma_b * sigma_b);
+    }
+    return l;
+}
+
+using pf_t = particle_filter_t<4, 2, 1, n_particles>;
+
+static pf_t pf(propagate, log_likelihood, make_numeric_vector({9., 11., 0., 0.}), make_numeric_vector({1., 1., 1., 1.}), 42);
+static pf_t pf_same_seed(propagate, log_likelihood, make_numeric_vector({9., 11., 0., 0.}), make_numeric_vector({1., 1., 1., 1.}), 42);
+
+int main() {
+    // Random variates
+    xorshift_t rng(7);
+    real_t mean_u = 0, mean_n = 0, var_n = 0;
+    for (size_t i = 0; i < 100000; ++i) {
+        const real_t u = rng.uniform();
+        assert(u >= 0 && u < 1);
+        const real_t n = rng.normal();
+        mean_u += u;
+        mean_n += n;
+        var_n += n * n;
+    }
+    assert(abs(mean_u / 100000 - 0.5) < 0.01);
+    assert(abs(mean_n / 100000) < 0.02 && abs(var_n / 100000 - 1) < 0.02);
+
+    // Systematic resampling of a tiny filter keeps particles in proportion to weight
+    {
+        particle_filter_t<1, 1, 1, 8> small([](numeric_vector<1> &, const numeric_vector<1> &, xorshift_t &) {},
+                                            [](const numeric_vector<1> &x, const numeric_vector<1> &) { return x[0] > 0 ? 0. : -HUGE_VAL; },
+                                            make_numeric_vector({0.}), make_numeric_vector({1.}), 3);
+        small.set_resample_threshold(1.1).update(make_numeric_vector({0.}));
+        for (size_t i = 0; i < small.size(); ++i) assert(small.particles(0)[i] > 0);
+        assert(small.effective_sample_size() == 8);
+    }
+
+    // Bearing-only tracking
+    real_t x = 10, y = 10, vx = 1, vy = -0.5;
+    real_t total_ms = 0;
+    for (size_t k = 0; k < steps; ++k) {
+        x += dt * vx;
+        y += dt * vy;
+        numeric_vector<2> z;
+        for (size_t s = 0; s < 2; ++s) z[s] = atan2(y - obs_y[s], x - obs_x[s]) + sigma_b * (static_cast<real_t>(k % 3) - 1) * 0.5;
+
+        const auto start = std::chrono::steady_clock::now();
+        pf << z;
+        const auto stop = std::chrono::steady_clock::now();
+        total_ms += std::chrono::duration<real_t, std::milli>(stop - start).count();
+
+        pf_same_seed << z;
+        real_t w_sum = 0;
+        for (size_t i = 0; i < pf.size(); ++i) w_sum += pf.weights()[i];
+        assert(abs(w_sum - 1) < 1e-9);
+        assert(pf.effective_sample_size() > 0);
+    }
+
+    // Same seed reproduces the run exactly
+    assert(pf.state_vector() == pf_same_seed.state_vector());
+
+    const real_t err = sqrt((pf.state_vector()[0] - x) * (pf.state_vector()[0] - x) + (pf.state_vector()[1] - y) * (pf.state_vector()[1] - y));
+    assert(err < 0.5);
+    const numeric_matrix<4, 4> P = pf.covariance();
+    assert(P[0][0] > 0 && P[1][1] > 0);
+
+    std::cout << "Position error: " << err << ", " << n_particles << " particles, "
+              << total_ms / steps << " ms per step\n";
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt     = 0.01;
+constexpr size_t steps  = 60;
+constexpr size_t n_long = 200000;
+
+numeric_vector<2> f(const numeric_vector<2> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt * x[1], x[1]});
+}
+
+numeric_matrix<2, 2> Fj(const numeric_vector<2> &, const numeric_vector<1> &) {
+    return make_numeric_matrix<2, 2>({{1, dt},
+                                      {0, 1}});
+}
+
+numeric_vector<1> h(const numeric_vector<2> &x) { return make_numeric_vector({x[0] * x[0]}); }
+
+numeric_matrix<1, 2> Hj(const numeric_vector<2> &x) { return make_numeric_matrix<1, 2>({{2 * x[0], 0}}); }
+
+static rts_smoother_t<3, n_long> long_run;
+
+int main() {
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<1, 3> H({{1, 0, 0}});
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(2.).Q + numeric_matrix<3, 3>::diagonals(1e-3);
+    const numeric_matrix<1, 1> R = numeric_matrix<1, 1>::diagonals(0.05);
+    const numeric_vector<3> x0   = {};
+
+    // Record a short run and keep a dense copy for the reference backward pass
+    kalman_filter_t<3, 1, 1> kf(F, B, H, Q, R, x0);
+    rts_smoother_t<3, steps> rts;
+    numeric_vector<3> xp[steps], xf[steps];
+    numeric_matrix<3, 3> Pp[steps], Pf[steps];
+    real_t truth[steps];
+
+    for (size_t k = 0; k < steps; ++k) {
+        const real_t t = k * dt;
+        truth[k]       = 3 * t * t + t;
+        [[maybe_unused]] const bool recorded = rts.record(kf, truth[k] + (static_cast<real_t>(k % 5) - 2) * 0.2);
+        assert(recorded);
+        xf[k] = kf.state_vector;
+        Pf[k] = kf.covariance();
+    }
+    [[maybe_unused]] const bool overflowed = rts.record(kf, 0.);
+    assert(!overflowed);
+    assert(rts.size() == steps);
+    for (size_t k = 0; k < steps; ++k) assert(rts.state(k).float_equals(xf[k]));
+
+    // Reference smoother using dense solves
+    numeric_vector<3> xs_ref[steps];
+    numeric_matrix<3, 3> Ps_ref[steps];
+    {
+        kalman_filter_t<3, 1, 1> kf_ref(F, B, H, Q, R, x0);
+        for (size_t k = 0; k < steps; ++k) {
+            kf_ref.predict();
+            xp[k] = kf_ref.state_vector;
+            Pp[k] = kf_ref.covariance();
+            kf_ref.update(truth[k] + (static_cast<real_t>(k % 5) - 2) * 0.2);
+        }
+        xs_ref[steps - 1] = xf[steps - 1];
+        Ps_ref[steps - 1] = Pf[steps - 1];
+        for (size_t k = steps - 1; k-- > 0;) {
+            const numeric_matrix<3, 3> C = Pf[k] * F.transpose() * Pp[k + 1].solve(numeric_matrix<3, 3>::identity());
+            xs_ref[k]                    = xf[k] + C * (xs_ref[k + 1] - xp[k + 1]);
+            Ps_ref[k]                    = Pf[k] + C * (Ps_ref[k + 1] - Pp[k + 1]) * C.transpose();
+        }
+    }
+
+    rts.smooth();
+    real_t err_f = 0, err_s = 0;
+    for (size_t k = 0; k < steps; ++k) {
+        assert(rts.state(k).float_equals(xs_ref[k], 1e-9));
+        assert(rts.covariance(k).float_equals(Ps_ref[k], 1e-9));
+        assert(rts.covariance(k)[0][0] <= Pf[k][0][0] + 1e-15);
+        err_f += abs(xf[k][0] - truth[k]);
+        err_s += abs(rts.state(k)[0] - truth[k]);
+    }
+    assert(err_s < err_f);
+
+    // Extended filter records its Jacobian
+    const numeric_matrix<2, 2> Q2 = numeric_matrix<2, 2>::diagonals(1e-4);
+    const numeric_matrix<1, 1> R2 = numeric_matrix<1, 1>::diagonals(0.01);
+    extended_kalman_filter_t<2, 1, 1> ekf(f, Fj, h, Hj, Q2, R2, make_numeric_vector({1., 0.}));
+    rts_smoother_t<2, 100> rts_ekf;
+    real_t err_ekf_f = 0, err_ekf_s = 0;
+    for (size_t k = 0; k < 100; ++k) {
+        const real_t p = 1 + 0.5 * static_cast<real_t>(k) * dt;
+        rts_ekf.record(ekf, make_numeric_vector({p * p}), numeric_vector<1>());
+        err_ekf_f += abs(ekf.state_vector[1] - 0.5);
+    }
+    rts_ekf.smooth();
+    for (size_t k = 0; k < 100; ++k) err_ekf_s += abs(rts_ekf.state(k)[1] - 0.5);
+    assert(err_ekf_s < err_ekf_f);
+
+    // Long replay in preallocated storage
+    kalman_filter_t<3, 1, 1> kf_long(F, B, H, Q, R, x0);
+    for (size_t k = 0; k < n_long; ++k) long_run.record(kf_long, (static_cast<real_t>(k % 5) - 2) * 0.2);
+    long_run.smooth();
+    assert(long_run.size() == n_long && long_run.is_smooth());
+
+    std::cout << "Mean abs error filtered: " << err_f / steps << ", smoothed: " << err_s / steps << '\n';
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.05;
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt * x[2], x[1] + dt * x[3], x[2], x[3]});
+}
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) {
+    return make_numeric_matrix<4, 4>({{1, 0, dt, 0},
+                                      {0, 1, 0, dt},
+                                      {0, 0, 1, 0},
+                                      {0, 0, 0, 1}});
+}
+
+// Position and a linear combination observed directly
+numeric_vector<3> h(const numeric_vector<4> &x) {
+    return make_numeric_vector({x[0], x[1], x[0] + 0.5 * x[3]});
+}
+
+numeric_matrix<3, 4> Hj(const numeric_vector<4> &) {
+    return make_numeric_matrix<3, 4>({{1, 0, 0, 0},
+                                      {0, 1, 0, 0},
+                                      {1, 0, 0, 0.5}});
+}
+
+int main() {
+    const numeric_matrix<4, 4> F  = Fj({}, {});
+    const numeric_matrix<4, 1> B  = {};
+    const numeric_matrix<3, 4> H  = Hj({});
+    const numeric_matrix<4, 4> Q  = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<3, 3> R  = make_diagonal_matrix({0.1, 0.2, 0.05});
+    const numeric_matrix<3, 3> Rc = make_numeric_matrix<3, 3>({{0.1, 0.01, 0},
+                                                                {0.01, 0.2, 0},
+                                                                {0, 0, 0.05}});
+    const numeric_vector<4> x0    = {};
+
+    assert(R.is_diagonal() && !Rc.is_diagonal());
+
+    // Linear filter: sequential mode is picked for diagonal R and matches the batch update
+    kalman_filter_t<4, 3, 1> kf_seq(F, B, H, Q, R, x0);
+    kalman_filter_t<4, 3, 1> kf_std(F, B, H, Q, R, x0);
+    kf_std.set_sequential(false);
+    assert(kf_seq.is_sequential() && !kf_std.is_sequential());
+    assert(!(kalman_filter_t<4, 3, 1>(F, B, H, Q, Rc, x0).is_sequential()));
+
+    // Extended filter with the same (linear) model
+    extended_kalman_filter_t<4, 3, 1> ekf_seq(f, Fj, h, Hj, Q, R, x0);
+    extended_kalman_filter_t<4, 3, 1> ekf_std(f, Fj, h, Hj, Q, R, x0);
+    ekf_std.set_sequential(false);
+
+    for (int k = 0; k < 200; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<3> z({2 * t + ((k % 5) - 2) * 0.1, -t + ((k % 3) - 1) * 0.2, 2 * t - 0.5});
+
+        kf_seq.predict().update(z);
+        kf_std.predict().update(z);
+        assert(kf_seq.state_vector.float_equals(kf_std.state_vector, 1e-9));
+
+        ekf_seq.predict().update(z);
+        ekf_std.predict().update(z);
+        assert(ekf_seq.state_vector.float_equals(ekf_std.state_vector, 1e-9));
+        assert(ekf_seq.state_vector.float_equals(kf_seq.state_vector, 1e-9));
+    }
+
+    std::cout << "Sequential state: ";
+    for (auto &x: kf_seq.state_vector) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vector>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt      = 0.1;
+constexpr size_t rows    = 20;
+constexpr size_t tracks  = rows * rows;
+constexpr size_t max_det = tracks + tracks / 2;
+
+using tracker_t = kalman_filter_t<4, 2, 1>;
+
+static gnn_associator_t<2, tracks, max_det> dense(9.21);
+static gnn_associator_t<2, tracks, max_det> indexed(9.21);
+static track_grid_t<2, tracks> grid_index(1., 9.21);
+
+int main() {
+    // Range queries return exactly the brute-force neighbours once filtered by distance
+    {
+        static spatial_grid_t<3, 500, 128> grid(0.5);
+        numeric_vector<3> points[500];
+        xorshift_t rng(3);
+        for (size_t i = 0; i < 500; ++i) {
+            for (size_t d = 0; d < 3; ++d) points[i][d] = rng.uniform() * 4 - 2;
+            assert(grid.place(i, points[i]));
+        }
+        assert(grid.size() == 500);
+
+        for (size_t pass = 0; pass < 3; ++pass) {
+            for (size_t q = 0; q < 50; ++q) {
+                numeric_vector<3> p;
+                for (size_t d = 0; d < 3; ++d) p[d] = rng.uniform() * 4 - 2;
+                const real_t r = 0.2 + 0.1 * static_cast<real_t>(q % 5);
+
+                bool seen[500] = {};
+                grid.query(p, r, [&](size_t i) {
+                    assert(!seen[i]);
+                    seen[i] = true;
+                });
+                for (size_t i = 0; i < 500; ++i) {
+                    const numeric_vector<3> diff = points[i] - p;
+                    if (grid.contains(i) && diff.dot(diff) <= r * r) assert(seen[i]);
+                }
+            }
+
+            // Small moves mostly stay in their cell, removed items are no longer reported
+            size_t moved = 0;
+            for (size_t i = pass; i < 500; ++i) {
+                for (size_t d = 0; d < 3; ++d) points[i][d] += (rng.uniform() - 0.5) * 0.05;
+                moved += grid.place(i, points[i]);
+            }
+            assert(moved < 100);
+            grid.remove(pass);
+            assert(!grid.contains(pass) && grid.size() == 499 - pass);
+        }
+    }
+
+    // Lattice of slowly moving targets, detections with clutter, indexed and dense gating agree
+    const numeric_matrix<4, 4> F({{1, dt, 0, 0},
+                                  {0, 1, 0, 0},
+                                  {0, 0, 1, dt},
+                                  {0, 0, 0, 1}});
+    const numeric_matrix<4, 1> B = {};
+    const numeric_matrix<2, 4> H({{1, 0, 0, 0},
+                                  {0, 0, 1, 0}});
+    const numeric_matrix<4, 4> Q = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<2, 2> R = numeric_matrix<2, 2>::diagonals(0.01);
+    const numeric_matrix<2, 2> R_wide = numeric_matrix<2, 2>::diagonals(1.);  // gate radius beyond a cell
+
+    std::vector<tracker_t> bank, bank_dense;
+    bank.reserve(tracks);
+    bank_dense.reserve(tracks);
+    for (size_t t = 0; t < tracks; ++t) {
+        const numeric_vector<4> x0({static_cast<real_t>(t % rows), 0.1, static_cast<real_t>(t / rows), 0.05});
+        bank.emplace_back(F, B, H, Q, t == 0 ? R_wide : R, x0);
+        bank_dense.emplace_back(F, B, H, Q, t == 0 ? R_wide : R, x0);
+    }
+
+    xorshift_t rng(7);
+    numeric_vector<2> z[max_det];
+    size_t truth_of[max_det];
+    size_t moved = 0, candidates = 0;
+    for (size_t k = 1; k <= 30; ++k) {
+        const real_t t_k = static_cast<real_t>(k) * dt;
+        size_t count     = 0;
+        for (size_t t = 0; t < tracks; ++t) {
+            if ((t + k) % 11 == 0) continue;  // missed detection
+            const size_t target = (t * 7 + k) % tracks;
+            z[count]            = make_numeric_vector({static_cast<real_t>(target % rows) + 0.1 * t_k + rng.normal(0, 0.05),
+                                                       static_cast<real_t>(target / rows) + 0.05 * t_k + rng.normal(0, 0.05)});
+            truth_of[count++]   = target;
+        }
+        while (count < max_det) {
+            z[count]          = make_numeric_vector({rng.uniform() * rows, rng.uniform() * rows});
+            truth_of[count++] = tracks;
+        }
+
+        for (size_t t = 0; t < tracks; ++t) {
+            bank[t].predict();
+            bank_dense[t].predict();
+        }
+
+        dense.associate(bank_dense.data(), tracks, z, count);
+        grid_index.refresh(bank.data(), tracks);
+        indexed.associate(bank.data(), tracks, z, count, grid_index);
+        moved += grid_index.moved();
+        assert(grid_index.overflow() == 1 && grid_index.grid().size() == tracks - 1);
+        for (size_t d = 0; d < count; ++d) grid_index.for_each_candidate(z[d], indexed.gate(), [&](size_t) { ++candidates; });
+
+        for (size_t t = 0; t < tracks; ++t) {
+            assert(indexed.measurement_of(t) == dense.measurement_of(t));
+            if (indexed.measurement_of(t) != decltype(indexed)::unassigned && truth_of[indexed.measurement_of(t)] != tracks)
+                assert(truth_of[indexed.measurement_of(t)] == t);
+        }
+        assert(indexed.cost().float_equals(dense.cost(), 0));
+
+        indexed.update(bank.data(), z);
+        dense.update(bank_dense.data(), z);
+    }
+    assert(grid_index.size() == tracks && moved < 30 * tracks / 2);
+    assert(candidates < 30 * tracks * max_det / 20);
+
+    std::cout << "Mahalanobis evaluations per scan, dense: " << tracks * max_det << ", indexed: " << candidates / 30
+              << ", tracks changing cell per scan: " << static_cast<real_t>(moved) / 30 << '\n';
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vt_linalg>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+template<typename T, size_t Row, size_t Col>
+bool near(const generic_matrix<T, Row, Col> &A, const generic_matrix<T, Row, Col> &B, real_t tol = 1e-9) {
+    for (size_t i = 0; i < Row; ++i)
+        for (size_t j = 0; j < Col; ++j)
+            if (abs(A[i][j] - B[i][j]) > tol) return false;
+    return true;
+}
+
+constexpr real_t dt = 0.01;
+
+int main() {
+    // Cholesky factor, triangularization and triangular solves
+    numeric_matrix<3> P({{4, 2, 0.4},
+                         {2, 5, 1},
+                         {0.4, 1, 3}});
+    const numeric_matrix<3> Lp = P.cholesky();
+    assert(Lp[0][1] == 0 && Lp[0][2] == 0 && Lp[1][2] == 0);
+    assert(near(Lp.matmul_T(Lp), P));
+
+    numeric_matrix<3, 5> A({{1, 2, 0, -1, 3},
+                            {0.5, -1, 2, 1, 0},
+                            {2, 0, 1, 1, -1}});
+    const numeric_matrix<3> La = A.tria();
+    assert(La[0][1] == 0 && La[0][2] == 0 && La[1][2] == 0 && La[2][2] >= 0);
+    assert(near(La.matmul_T(La), A.matmul_T(A)));
+
+    const numeric_vector<3> b({1, -2, 0.5});
+    assert((Lp * Lp.solve_lower(b)).float_equals(b));
+    assert((Lp.transpose() * Lp.solve_lower_T(b)).float_equals(b));
+
+    // Semi-definite input: zero column instead of NaN
+    const numeric_matrix<2> Ls = make_numeric_matrix({{1, 1},
+                                                      {1, 1}})
+                                         .cholesky();
+    assert(Ls[1][1] == 0 && Ls[1][0] == 1);
+
+    // Square-root filter agrees with the covariance form
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B = {};
+    const numeric_matrix<2, 3> H({{1, 0, 0},
+                                  {0, 0, 1}});
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(0.5).Q + numeric_matrix<3, 3>::diagonals(1e-9);
+    const numeric_matrix<2, 2> R({{0.01, 0.002},
+                                  {0.002, 0.04}});
+    const numeric_vector<3> x0   = {};
+
+    kalman_filter_t<3, 2, 1> kf(F, B, H, Q, R, x0);
+    sqrt_kalman_filter_t<3, 2, 1> skf(F, B, H, Q, R, x0);
+
+    for (int k = 0; k < 500; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<2> z({t * t + ((k % 5) - 2) * 0.05, 2 + ((k % 3) - 1) * 0.1});
+        kf.predict().update(z);
+        skf.predict().update(z);
+        assert(skf.state_vector().float_equals(kf.state_vector, 1e-8));
+    }
+
+    // Single precision over a long run stays positive definite and tracks double
+    generic_matrix<float, 3, 3> Ff;
+    generic_matrix<float, 3, 1> Bf;
+    generic_matrix<float, 2, 3> Hf;
+    generic_matrix<float, 3, 3> Qf;
+    generic_matrix<float, 2, 2> Rf;
+    for (size_t i = 0; i < 3; ++i)
+        for (size_t j = 0; j < 3; ++j) {
+            Ff[i][j] = static_cast<float>(F[i][j]);
+            Qf[i][j] = static_cast<float>(Q[i][j]);
+        }
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 3; ++j) Hf[i][j] = static_cast<float>(H[i][j]);
+        for (size_t j = 0; j < 2; ++j) Rf[i][j] = static_cast<float>(R[i][j]);
+    }
+    sqrt_kalman_filter_t<3, 2, 1, float> skf_f(Ff, Bf, Hf, Qf, Rf, generic_vector<float, 3>());
+    sqrt_kalman_filter_t<3, 2, 1> skf_d(F, B, H, Q, R, x0);
+
+    for (int k = 0; k < 20000; ++k) {
+        const real_t t = (k % 2000) * dt;
+        const real_t p = 0.5 * t * t + ((k % 7) - 3) * 0.05;
+        const real_t a = 1 + ((k % 3) - 1) * 0.1;
+        skf_f.predict().update(static_cast<float>(p), static_cast<float>(a));
+        skf_d.predict().update(p, a);
+    }
+    const auto Pf = skf_f.covariance();
+    for (size_t i = 0; i < 3; ++i) {
+        assert(Pf[i][i] > 0);
+        for (size_t j = 0; j < 3; ++j) assert(Pf[i][j] == Pf[j][i]);
+        assert(abs(skf_f.state_vector()[i] - skf_d.state_vector()[i]) < 1e-2 * (1 + abs(skf_d.state_vector()[i])));
+    }
+
+    std::cout << "Square-root state (float): ";
+    for (auto &x: skf_f.state_vector()) std::cout << x << ' ';
+    std::cout << "\nSquare-root state (double): ";
+    for (auto &x: skf_d.state_vector()) std::cout << x << ' ';
+    std::cout << '\n';
+
+    return 0;
+}
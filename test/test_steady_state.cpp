@@ -0,0 +1,51 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.01;
+
+int main() {
+    const numeric_matrix<3, 3> F = vdt<2>(dt).generate_F();
+    const numeric_matrix<3, 1> B({{0}, {0}, {dt}});
+    const numeric_matrix<2, 3> H({{1, 0, 0},
+                                  {0, 0, 1}});
+    const numeric_matrix<3, 3> Q = vdt<2>(dt).generate_model(0.5).Q;
+    const numeric_matrix<2, 2> R = make_diagonal_matrix({0.01, 0.1});
+    const numeric_vector<3> x0   = {};
+
+    // DARE residual
+    const numeric_matrix<3, 3> P   = dare(F, H, Q, R);
+    const numeric_matrix<3, 2> PHt = P.matmul_T(H);
+    const numeric_matrix<3, 3> rhs = F * (P - PHt * (H * PHt + R).solve(PHt.transpose())).matmul_T(F) + Q;
+    assert(P.float_equals(rhs, 1e-12));
+
+    // Gain of the time-varying filter converges to the steady-state gain
+    kalman_filter_t<3, 2, 1> kf(F, B, H, Q, R, x0);
+    steady_state_kalman_filter_t<3, 2, 1> ss(F, B, H, Q, R, x0);
+    steady_state_kalman_filter_t<3, 2, 1> ss_split(F, B, H, Q, R, x0);
+
+    for (int k = 0; k < 5000; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<1> u({0.2});
+        const numeric_vector<2> z({0.5 * t * t + ((k % 7) - 3) * 0.05, 1 + ((k % 3) - 1) * 0.2});
+        kf.predict(u).update(z);
+        ss.step(z, u);
+        ss_split.predict(u).update(z);
+        assert(ss.state_vector().float_equals(ss_split.state_vector(), 1e-9));
+    }
+    assert(ss.state_vector().float_equals(kf.state_vector, 1e-8));
+
+    // Lookup table gains come from the same solver
+    const real_t periods[] = {dt};
+    kalman_lut_t<3, 2, 1> lut(periods, [&](const real_t &) { return discrete_model_t<3>{F, Q}; });
+    lut.precompute_gain(H, R);
+    assert(lut[0].K.float_equals(ss.gain()));
+
+    std::cout << "Steady-state gain: ";
+    for (size_t i = 0; i < 3; ++i) std::cout << ss.gain()[i][0] << ' ' << ss.gain()[i][1] << "; ";
+    std::cout << '\n';
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <vt_kalman>
+#include <assert.h>
+
+using namespace vt;
+
+constexpr real_t dt = 0.1;
+
+numeric_vector<4> f(const numeric_vector<4> &x, const numeric_vector<1> &) {
+    return make_numeric_vector({x[0] + dt * x[2], x[1] + dt * x[3], x[2], x[3]});
+}
+
+numeric_matrix<4, 4> Fj(const numeric_vector<4> &, const numeric_vector<1> &) {
+    return make_numeric_matrix<4, 4>({{1, 0, dt, 0},
+                                      {0, 1, 0, dt},
+                                      {0, 0, 1, 0},
+                                      {0, 0, 0, 1}});
+}
+
+// Range and bearing from the origin
+numeric_vector<2> h(const numeric_vector<4> &x) {
+    return make_numeric_vector({sqrt(x[0] * x[0] + x[1] * x[1]), atan2(x[1], x[0])});
+}
+
+struct wide_params_t {
+    static constexpr real_t alpha = 1.;
+    static constexpr real_t beta  = 2.;
+    static constexpr real_t kappa = -1.;
+};
+
+int main() {
+    using ukf_t = future::unscented_kalman_filter_t<4, 2, 1>;
+    static_assert(ukf_t::Wm_0 + 8 * ukf_t::W_i > 1 - 1e-12 && ukf_t::Wm_0 + 8 * ukf_t::W_i < 1 + 1e-12,
+                  "Mean weights must sum to one");
+
+    const numeric_matrix<4, 4> F = Fj({}, {});
+    const numeric_matrix<4, 1> B = {};
+    const numeric_matrix<4, 4> Q = numeric_matrix<4, 4>::diagonals(1e-3);
+    const numeric_matrix<2, 4> H({{1, 0, 0, 0},
+                                  {0, 1, 0, 0}});
+    const numeric_matrix<2, 2> R = numeric_matrix<2, 2>::diagonals(0.05);
+    const numeric_vector<4> x0({10, 5, 0, 0});
+
+    // Linear models: the unscented transform is exact and matches the Kalman filter
+    kalman_filter_t<4, 2, 1> kf(F, B, H, Q, R, x0);
+    auto ukf_lin = future::make_unscented_kalman_filter<4, 2, 1>(
+            [&](const numeric_vector<4> &x, const numeric_vector<1> &) { return F * x; },
+            [&](const numeric_vector<4> &x) { return H * x; }, Q, R, x0);
+    auto ukf_wide = future::make_unscented_kalman_filter<4, 2, 1, wide_params_t>(
+            [&](const numeric_vector<4> &x, const numeric_vector<1> &) { return F * x; },
+            [&](const numeric_vector<4> &x) { return H * x; }, Q, R, x0);
+
+    for (int k = 0; k < 100; ++k) {
+        const real_t t = k * dt;
+        const numeric_vector<2> z({10 + t + ((k % 5) - 2) * 0.1, 5 - 0.5 * t + ((k % 3) - 1) * 0.1});
+        kf.predict().update(z);
+        ukf_lin.predict().update(z);
+        ukf_wide << z;
+        assert(ukf_lin.state_vector().float_equals(kf.state_vector, 1e-8));
+        assert(ukf_wide.state_vector().float_equals(kf.state_vector, 1e-8));
+    }
+
+    // Range-bearing tracking with function pointers
+    const numeric_matrix<2, 2> R_rb = make_diagonal_matrix({0.04, 0.0004});
+    const numeric_vector<4> x0_rb({9, 6, 0, 0});
+    ukf_t ukf(f, h, Q, R_rb, x0_rb);
+
+    numeric_vector<4> truth({10, 5, 1, -0.5});
+    real_t err_ukf = 0;
+    for (int k = 0; k < 200; ++k) {
+        truth                   = f(truth, {});
+        const real_t n          = ((k % 7) - 3) / 3.;
+        const numeric_vector<2> z = h(truth) + make_numeric_vector({0.2 * n, 0.02 * -n});
+        ukf.predict().update(z);
+        if (k >= 100) err_ukf += (ukf.state_vector() - truth).norm();
+    }
+    assert(err_ukf / 100 < 0.5);
+
+    std::cout << "Mean position error UKF: " << err_ukf / 100 << '\n';
+
+    return 0;
+}